@@ -0,0 +1,470 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   alloc_hooks.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <elf.h>
+#include <execinfo.h>
+#include <fcntl.h>
+#include <link.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "alloc_hooks.h"
+
+/* The linker resolves __real_* to the libc allocator and redirects every
+ * malloc/free/calloc/realloc/strdup reference in our objects to __wrap_*. */
+void    *__real_malloc(size_t size);
+void    __real_free(void *ptr);
+void    *__real_calloc(size_t n, size_t size);
+void    *__real_realloc(void *ptr, size_t size);
+
+void    *__wrap_malloc(size_t size);
+void    __wrap_free(void *ptr);
+void    *__wrap_calloc(size_t n, size_t size);
+void    *__wrap_realloc(void *ptr, size_t size);
+char    *__wrap_strdup(const char *s);
+
+static t_alloc_stats            g_stats;
+static const t_alloc_backend    *g_backend;
+
+static inline void count(unsigned long *counter, unsigned long n)
+{
+    __atomic_add_fetch(counter, n, __ATOMIC_RELAXED);
+}
+
+/* ========== Live Allocation Table (leak tracking) ========== */
+
+/* Open-addressing hash table keyed by pointer, with backward-shift
+ * deletion so lookups never have to skip tombstones. It only holds
+ * allocations made while a tag is active (see alloc_track_start). */
+#define TRACK_FRAMES    8
+#define TRACK_MIN_CAP   1024
+
+typedef struct s_block
+{
+    void    *ptr;
+    size_t  size;
+    int     tag;
+    int     depth;
+    void    *frames[TRACK_FRAMES];
+}   t_block;
+
+static pthread_mutex_t  g_lock = PTHREAD_MUTEX_INITIALIZER;
+static t_block          *g_table;
+static size_t           g_cap;
+static size_t           g_used;
+static __thread int     g_tag;
+static __thread volatile int    g_unwinding;
+
+static inline size_t slot_of(const void *ptr, size_t cap)
+{
+    uintptr_t h = (uintptr_t)ptr >> 4;
+
+    h ^= h >> 17;
+    h *= 0x9E3779B97F4A7C15ull;
+    return (size_t)(h >> 7) & (cap - 1);
+}
+
+static int table_grow(void)
+{
+    size_t  cap = g_cap ? g_cap * 2 : TRACK_MIN_CAP;
+    t_block *table = __real_calloc(cap, sizeof(*table));
+
+    if (!table)
+        return -1;
+    for (size_t i = 0; i < g_cap; i++)
+    {
+        if (!g_table[i].ptr)
+            continue;
+        size_t j = slot_of(g_table[i].ptr, cap);
+        while (table[j].ptr)
+            j = (j + 1) & (cap - 1);
+        table[j] = g_table[i];
+    }
+    __real_free(g_table);
+    g_table = table;
+    g_cap = cap;
+    return 0;
+}
+
+static void table_insert(void *ptr, size_t size, int tag, void **frames, int depth)
+{
+    size_t i;
+
+    if ((g_used + 1) * 4 > g_cap * 3 && table_grow() < 0)
+        return ;
+    i = slot_of(ptr, g_cap);
+    while (g_table[i].ptr && g_table[i].ptr != ptr)
+        i = (i + 1) & (g_cap - 1);
+    if (!g_table[i].ptr)
+        g_used++;
+    g_table[i].ptr = ptr;
+    g_table[i].size = size;
+    g_table[i].tag = tag;
+    g_table[i].depth = depth;
+    memcpy(g_table[i].frames, frames, depth * sizeof(void *));
+}
+
+static void table_remove_at(size_t i)
+{
+    size_t j = i;
+
+    g_table[i].ptr = NULL;
+    g_used--;
+    while (1)
+    {
+        j = (j + 1) & (g_cap - 1);
+        if (!g_table[j].ptr)
+            return ;
+        size_t home = slot_of(g_table[j].ptr, g_cap);
+        /* move j back into the hole unless its home lies in (i, j] */
+        if ((j > i && (home <= i || home > j)) || (j < i && home <= i && home > j))
+        {
+            g_table[i] = g_table[j];
+            g_table[j].ptr = NULL;
+            i = j;
+        }
+    }
+}
+
+static void table_remove(void *ptr)
+{
+    size_t i;
+
+    if (!g_cap)
+        return ;
+    i = slot_of(ptr, g_cap);
+    while (g_table[i].ptr)
+    {
+        if (g_table[i].ptr == ptr)
+        {
+            table_remove_at(i);
+            return ;
+        }
+        i = (i + 1) & (g_cap - 1);
+    }
+}
+
+static void track_alloc(void *ptr, size_t size)
+{
+    void    *frames[TRACK_FRAMES + 1];
+    int     tag = g_tag;
+    int     depth;
+
+    if (!tag)
+        return ;
+    /* frames[0] is the wrapper itself */
+    g_unwinding = 1;
+    depth = backtrace(frames, TRACK_FRAMES + 1) - 1;
+    g_unwinding = 0;
+    pthread_mutex_lock(&g_lock);
+    table_insert(ptr, size, tag, frames + 1, depth < 0 ? 0 : depth);
+    pthread_mutex_unlock(&g_lock);
+}
+
+static void track_free(void *ptr)
+{
+    if (!__atomic_load_n(&g_cap, __ATOMIC_RELAXED))
+        return ;
+    pthread_mutex_lock(&g_lock);
+    table_remove(ptr);
+    pthread_mutex_unlock(&g_lock);
+}
+
+/* ========== Wrappers ========== */
+
+/* A backend has no calloc of its own */
+static void *backend_calloc(size_t n, size_t size)
+{
+    void *ptr;
+
+    if (size && n > SIZE_MAX / size)
+        return NULL;
+    if ((ptr = g_backend->malloc(n * size)))
+        memset(ptr, 0, n * size);
+    return ptr;
+}
+
+void *__wrap_malloc(size_t size)
+{
+    void *ptr = g_backend ? g_backend->malloc(size) : __real_malloc(size);
+
+    if (ptr)
+    {
+        count(&g_stats.mallocs, 1);
+        count(&g_stats.bytes, size);
+        track_alloc(ptr, size);
+    }
+    return ptr;
+}
+
+void __wrap_free(void *ptr)
+{
+    if (ptr)
+    {
+        count(&g_stats.frees, 1);
+        track_free(ptr);
+    }
+    if (g_backend)
+        g_backend->free(ptr);
+    else
+        __real_free(ptr);
+}
+
+void *__wrap_calloc(size_t n, size_t size)
+{
+    void *ptr = g_backend ? backend_calloc(n, size) : __real_calloc(n, size);
+
+    if (ptr)
+    {
+        count(&g_stats.mallocs, 1);
+        count(&g_stats.bytes, n * size);
+        track_alloc(ptr, n * size);
+    }
+    return ptr;
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    void *res = g_backend ? g_backend->realloc(ptr, size) : __real_realloc(ptr, size);
+
+    if (res)
+    {
+        count(ptr ? &g_stats.reallocs : &g_stats.mallocs, 1);
+        count(&g_stats.bytes, size);
+        if (ptr)
+            track_free(ptr);
+        track_alloc(res, size);
+    }
+    return res;
+}
+
+/* libc's strdup allocates behind our back; route it through the wrappers
+ * so strings duplicated by the tests are tracked like any other block. */
+char *__wrap_strdup(const char *s)
+{
+    size_t  len = strlen(s) + 1;
+    char    *dup = __wrap_malloc(len);
+
+    if (dup)
+        memcpy(dup, s, len);
+    return dup;
+}
+
+/* ========== Public API ========== */
+
+void alloc_set_backend(const t_alloc_backend *backend)
+{
+    g_backend = backend;
+}
+
+void alloc_stats_reset(void)
+{
+    __atomic_store_n(&g_stats.mallocs, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&g_stats.frees, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&g_stats.reallocs, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&g_stats.bytes, 0, __ATOMIC_RELAXED);
+}
+
+void alloc_stats_get(t_alloc_stats *out)
+{
+    out->mallocs = __atomic_load_n(&g_stats.mallocs, __ATOMIC_RELAXED);
+    out->frees = __atomic_load_n(&g_stats.frees, __ATOMIC_RELAXED);
+    out->reallocs = __atomic_load_n(&g_stats.reallocs, __ATOMIC_RELAXED);
+    out->bytes = __atomic_load_n(&g_stats.bytes, __ATOMIC_RELAXED);
+}
+
+void alloc_track_start(int tag)
+{
+    g_tag = tag;
+}
+
+int alloc_track_unwinding(void)
+{
+    return g_unwinding;
+}
+
+/* ========== Symbols ========== */
+
+/* The executable's .symtab names static functions too, and is all a
+ * static binary has: dladdr() only sees the dynamic symbol table. The
+ * file stays mapped, names point into it. Loaded once, with the real
+ * allocator so neither the stats nor the tracker see it. */
+typedef struct s_symbol
+{
+    uintptr_t   addr;
+    size_t      size;
+    const char  *name;
+}   t_symbol;
+
+static t_symbol         *g_syms;
+static size_t           g_nsyms;
+static uintptr_t        g_bias;
+static pthread_once_t   g_syms_once = PTHREAD_ONCE_INIT;
+
+static int by_addr(const void *a, const void *b)
+{
+    uintptr_t x = ((const t_symbol *)a)->addr;
+    uintptr_t y = ((const t_symbol *)b)->addr;
+
+    return (x > y) - (x < y);
+}
+
+static int main_object(struct dl_phdr_info *info, size_t size, void *bias)
+{
+    (void)size;
+    *(uintptr_t *)bias = info->dlpi_addr;
+    return 1;
+}
+
+static void load_symbols(void)
+{
+    const ElfW(Ehdr)    *eh;
+    const ElfW(Shdr)    *sh;
+    struct stat         st;
+    int                 fd = open("/proc/self/exe", O_RDONLY);
+
+    if (fd < 0 || fstat(fd, &st) < 0
+        || (eh = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED)
+    {
+        if (fd >= 0)
+            close(fd);
+        return ;
+    }
+    close(fd);
+    sh = (const ElfW(Shdr) *)((const char *)eh + eh->e_shoff);
+    for (int i = 0; i < eh->e_shnum; i++)
+    {
+        const ElfW(Sym) *sym = (const ElfW(Sym) *)((const char *)eh + sh[i].sh_offset);
+        const char      *str = (const char *)eh + sh[sh[i].sh_link].sh_offset;
+        size_t          count = sh[i].sh_size / sizeof(*sym);
+
+        if (sh[i].sh_type != SHT_SYMTAB
+            || !(g_syms = __real_calloc(count, sizeof(*g_syms))))
+            continue ;
+        for (size_t k = 0; k < count; k++)
+        {
+            if (ELF64_ST_TYPE(sym[k].st_info) == STT_FUNC && sym[k].st_size)
+                g_syms[g_nsyms++] = (t_symbol){sym[k].st_value,
+                    sym[k].st_size, str + sym[k].st_name};
+        }
+        qsort(g_syms, g_nsyms, sizeof(*g_syms), by_addr);
+        break ;
+    }
+    dl_iterate_phdr(main_object, &g_bias);
+}
+
+static const t_symbol *symtab_find(uintptr_t pc)
+{
+    size_t lo = 0;
+    size_t hi = g_nsyms;
+
+    pc -= g_bias;
+    while (lo < hi)
+    {
+        size_t mid = (lo + hi) / 2;
+
+        if (g_syms[mid].addr <= pc)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo && pc < g_syms[lo - 1].addr + g_syms[lo - 1].size)
+        return &g_syms[lo - 1];
+    return NULL;
+}
+
+const char *alloc_symbol(const void *pc, const void **start)
+{
+    const t_symbol  *sym;
+    Dl_info         info = {0};
+
+    pthread_once(&g_syms_once, load_symbols);
+    if ((sym = symtab_find((uintptr_t)pc)))
+    {
+        if (start)
+            *start = (const void *)(sym->addr + g_bias);
+        return sym->name;
+    }
+    if (!dladdr(pc, &info) || !info.dli_sname)
+        return NULL;
+    if (start)
+        *start = info.dli_saddr;
+    return info.dli_sname;
+}
+
+/* ========== Leak Sites ========== */
+
+/* Blame the outermost ft_* frame: for ft_split -> ft_substr -> malloc the
+ * leak belongs to the ft_split call made by the test. Blocks allocated
+ * without any ft_* frame on the stack come from the test code itself. */
+static const void *leak_site(const t_block *b)
+{
+    const void  *site = NULL;
+    const void  *start;
+    const char  *name;
+
+    for (int i = 0; i < b->depth; i++)
+    {
+        if ((name = alloc_symbol(b->frames[i], &start))
+            && strncmp(name, "ft_", 3) == 0)
+            site = start;
+    }
+    return site;
+}
+
+size_t alloc_track_stop(t_leak *leaks, size_t max)
+{
+    size_t  n = 0;
+    int     tag = g_tag;
+    size_t  i = 0;
+
+    g_tag = 0;
+    if (!tag)
+        return 0;
+    pthread_mutex_lock(&g_lock);
+    while (i < g_cap)
+    {
+        if (!g_table[i].ptr || g_table[i].tag != tag)
+        {
+            i++;
+            continue;
+        }
+        const void *site = leak_site(&g_table[i]);
+        size_t k = 0;
+        while (k < n && leaks[k].site != site)
+            k++;
+        if (k == n && n < max)
+            leaks[n++] = (t_leak){site, 0, 0};
+        if (k < n)
+        {
+            leaks[k].bytes += g_table[i].size;
+            leaks[k].blocks++;
+        }
+        /* forget the block; the shift may pull an unvisited entry into i */
+        table_remove_at(i);
+    }
+    pthread_mutex_unlock(&g_lock);
+    return n;
+}
+
+const char *alloc_site_name(const void *site)
+{
+    const char *name = site ? alloc_symbol(site, NULL) : NULL;
+
+    return name ? name : "test code";
+}
@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   alloc_hooks.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ALLOC_HOOKS_H
+# define ALLOC_HOOKS_H
+
+# include <stddef.h>
+
+/* 📦 Allocation counters fed by the malloc/free/calloc/realloc/strdup
+ *    wrappers in alloc_hooks.c. The wrappers are installed at link time
+ *    with $(WRAP_FLAGS), so only calls made from the tester objects and
+ *    from libft.a are seen; allocations done inside libc itself are not. */
+typedef struct s_alloc_stats
+{
+    unsigned long   mallocs;
+    unsigned long   frees;
+    unsigned long   reallocs;
+    unsigned long   bytes;
+}   t_alloc_stats;
+
+/* 🔍 Leaks still live when tracking stops, grouped by the ft_* function
+ *    that allocated them (site == NULL: allocated by the test code) */
+typedef struct s_leak
+{
+    const void  *site;
+    size_t      bytes;
+    size_t      blocks;
+}   t_leak;
+
+/* 🔌 Where the wrappers get their memory. NULL (the default) is libc's
+ *    allocator, or whichever one LD_PRELOAD put in front of it. Switch
+ *    only while no block is live that the other side would have to free. */
+typedef struct s_alloc_backend
+{
+    void    *(*malloc)(size_t size);
+    void    (*free)(void *ptr);
+    void    *(*realloc)(void *ptr, size_t size);
+}   t_alloc_backend;
+
+void        alloc_stats_reset(void);
+void        alloc_stats_get(t_alloc_stats *out);
+void        alloc_set_backend(const t_alloc_backend *backend);
+
+/* Blocks allocated by the calling thread while a non-zero tag is active
+ * are recorded with their call stack; alloc_track_stop() reports and
+ * forgets those still live. Other threads (e.g. run_isolated() jobs) are
+ * not tracked. Sites are named from the executable's .symtab, so static
+ * binaries get them too; stripped ones fall back on dladdr() and -rdynamic. */
+void        alloc_track_start(int tag);
+size_t      alloc_track_stop(t_leak *leaks, size_t max);
+const char  *alloc_site_name(const void *site);
+
+/* The function containing pc, NULL if unknown; *start (if given) gets
+ * its first instruction. Shared with the profiler. */
+const char  *alloc_symbol(const void *pc, const void **start);
+
+/* Non-zero while the calling thread is inside the tracker's backtrace();
+ * the profiler's signal handler must not unwind on top of it */
+int         alloc_track_unwinding(void);
+
+#endif
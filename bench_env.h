@@ -0,0 +1,318 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_env.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BENCH_ENV_H
+# define BENCH_ENV_H
+
+/* Needs _GNU_SOURCE (sched_setaffinity, CPU_SET), defined by the source
+ * before its first include */
+# include <math.h>
+# include <sched.h>
+# include <errno.h>
+# include <sys/utsname.h>
+# include <sys/resource.h>
+# include "bench_utils.h"
+# include "profiler.h"
+
+/* 🎛️ Benchmarks pin themselves to one CPU (the one they
+ *    started on, or --cpu N; --cpu -1 leaves them free), --priority asks
+ *    for nice -20, and the environment that makes numbers move between
+ *    runs is printed first: governor, turbo, an online SMT sibling. Every
+ *    timed measurement adds its repetitions to a t_bench_runs; when their
+ *    coefficient of variation is over --cv-max percent (default 5) the run
+ *    ends with a warning naming the worst of them. */
+# ifndef MONSTERS_CFLAGS
+#  define MONSTERS_CFLAGS "?"
+# endif
+# ifdef __clang__
+#  define BENCH_COMPILER "clang " __clang_version__
+# else
+#  define BENCH_COMPILER "gcc " __VERSION__
+# endif
+# define BENCH_CV_MAX       5.0
+# define BENCH_NOISY_SHOWN  5
+
+typedef struct s_bench_runs
+{
+    int     n;
+    double  mean;
+    double  m2;
+}   t_bench_runs;
+
+typedef struct s_bench_env
+{
+    int         cpu;
+    int         priority;
+    double      cv_max;
+    int         noisy;
+    int         checked;
+    char        worst[BENCH_NOISY_SHOWN][64];
+    double      worst_cv[BENCH_NOISY_SHOWN];
+    const char  *profile;
+    const char  *profile_only;
+    int         profile_hz;
+}   t_bench_env;
+
+static t_bench_env  g_bench_env = {-2, 0, BENCH_CV_MAX, 0, 0, {{0}}, {0},
+                                   NULL, NULL, 0};
+
+/* Welford: mean and variance in one pass, without keeping the samples */
+static inline void bench_runs_add(t_bench_runs *r, double x)
+{
+    double d = x - r->mean;
+
+    r->n++;
+    r->mean += d / r->n;
+    r->m2 += d * (x - r->mean);
+}
+
+static inline double bench_runs_cv(const t_bench_runs *r)
+{
+    if (r->n < 2 || r->mean <= 0)
+        return 0;
+    return sqrt(r->m2 / (r->n - 1)) / r->mean * 100;
+}
+
+/* Keeps the BENCH_NOISY_SHOWN noisiest measurements for bench_env_end() */
+static inline void bench_check_cv(const char *what, const t_bench_runs *r)
+{
+    double  cv = bench_runs_cv(r);
+    int     at = BENCH_NOISY_SHOWN;
+    size_t  len;
+
+    g_bench_env.checked += r->n > 1;
+    if (cv <= g_bench_env.cv_max)
+        return ;
+    g_bench_env.noisy++;
+    while (at > 0 && cv > g_bench_env.worst_cv[at - 1])
+        at--;
+    if (at == BENCH_NOISY_SHOWN)
+        return ;
+    memmove(g_bench_env.worst[at + 1], g_bench_env.worst[at],
+            (BENCH_NOISY_SHOWN - at - 1) * sizeof(g_bench_env.worst[0]));
+    memmove(&g_bench_env.worst_cv[at + 1], &g_bench_env.worst_cv[at],
+            (BENCH_NOISY_SHOWN - at - 1) * sizeof(double));
+    len = strnlen(what, sizeof(g_bench_env.worst[0]) - 1);
+    memcpy(g_bench_env.worst[at], what, len);
+    g_bench_env.worst[at][len] = '\0';
+    g_bench_env.worst_cv[at] = cv;
+}
+
+/* --cpu N, --priority, --cv-max P and --profile FILE, --profile-only LIST,
+ * --profile-hz N (see profiler.h); returns 1 when argv[*i] was one */
+static inline int bench_env_arg(int argc, char **argv, int *i)
+{
+    if (strcmp(argv[*i], "--cpu") == 0 && *i + 1 < argc)
+        g_bench_env.cpu = atoi(argv[++*i]);
+    else if (strcmp(argv[*i], "--priority") == 0)
+        g_bench_env.priority = 1;
+    else if (strcmp(argv[*i], "--cv-max") == 0 && *i + 1 < argc)
+        g_bench_env.cv_max = atof(argv[++*i]);
+    else if (strcmp(argv[*i], "--profile") == 0 && *i + 1 < argc)
+        g_bench_env.profile = argv[++*i];
+    else if (strcmp(argv[*i], "--profile-only") == 0 && *i + 1 < argc)
+        g_bench_env.profile_only = argv[++*i];
+    else if (strcmp(argv[*i], "--profile-hz") == 0 && *i + 1 < argc)
+        g_bench_env.profile_hz = atoi(argv[++*i]);
+    else
+        return 0;
+    return 1;
+}
+
+/* First line of a /sys or /proc file, without its newline; "" if absent */
+static inline const char *bench_read_line(char *buf, size_t size, const char *fmt,
+                                          int cpu)
+{
+    char    path[128];
+    FILE    *f;
+
+    snprintf(path, sizeof(path), fmt, cpu);
+    buf[0] = '\0';
+    if ((f = fopen(path, "r")))
+    {
+        if (!fgets(buf, size, f))
+            buf[0] = '\0';
+        fclose(f);
+    }
+    buf[strcspn(buf, "\n")] = '\0';
+    return buf;
+}
+
+static inline void bench_cpu_model(char *buf, size_t size)
+{
+    char    line[256];
+    FILE    *f = fopen("/proc/cpuinfo", "r");
+
+    snprintf(buf, size, "?");
+    while (f && fgets(line, sizeof(line), f))
+    {
+        char *colon = strchr(line, ':');
+
+        if (colon && (strncmp(line, "model name", 10) == 0
+                      || strncmp(line, "Model", 5) == 0))
+        {
+            colon += 1 + (colon[1] == ' ');
+            colon[strcspn(colon, "\n")] = '\0';
+            snprintf(buf, size, "%s", colon);
+            break ;
+        }
+    }
+    if (f)
+        fclose(f);
+}
+
+/* 1 turbo on, 0 off, -1 unknown (intel_pstate, then acpi-cpufreq/amd) */
+static inline int bench_turbo(void)
+{
+    char buf[16];
+
+    if (*bench_read_line(buf, sizeof(buf),
+                         "/sys/devices/system/cpu/intel_pstate/no_turbo", 0))
+        return buf[0] == '0';
+    if (*bench_read_line(buf, sizeof(buf),
+                         "/sys/devices/system/cpu/cpufreq/boost", 0))
+        return buf[0] == '1';
+    return -1;
+}
+
+/* Siblings of cpu on the same core, as listed by the kernel ("3,35"),
+ * without cpu itself; returns how many there are */
+static inline int bench_smt_siblings(int cpu, char *out, size_t size)
+{
+    char    list[128];
+    char    *p;
+    int     count = 0;
+
+    out[0] = '\0';
+    bench_read_line(list, sizeof(list),
+                    "/sys/devices/system/cpu/cpu%d/topology/thread_siblings_list", cpu);
+    for (p = strtok(list, ","); p; p = strtok(NULL, ","))
+    {
+        int lo = atoi(p);
+        int hi = strchr(p, '-') ? atoi(strchr(p, '-') + 1) : lo;
+
+        for (int c = lo; c <= hi; c++)
+        {
+            if (c == cpu)
+                continue ;
+            snprintf(out + strlen(out), size - strlen(out), "%s%d", count ? "," : "", c);
+            count++;
+        }
+    }
+    return count;
+}
+
+static inline void bench_env_pin(void)
+{
+    cpu_set_t   set;
+
+    if (g_bench_env.cpu == -2)
+        g_bench_env.cpu = sched_getcpu();
+    if (g_bench_env.cpu >= 0)
+    {
+        CPU_ZERO(&set);
+        CPU_SET(g_bench_env.cpu, &set);
+        if (sched_setaffinity(0, sizeof(set), &set) < 0)
+        {
+            printf("%s  ⚠ cannot pin to cpu %d: %s%s\n", CLR_YELLOW,
+                   g_bench_env.cpu, strerror(errno), CLR_RESET);
+            g_bench_env.cpu = -1;
+        }
+    }
+    if (g_bench_env.priority && setpriority(PRIO_PROCESS, 0, -20) < 0)
+        printf("%s  ⚠ cannot raise the priority: %s (needs root or "
+               "CAP_SYS_NICE)%s\n", CLR_YELLOW, strerror(errno), CLR_RESET);
+}
+
+/* Pins the process and prints what it runs on; call after parsing args */
+static inline void bench_env_begin(void)
+{
+    struct utsname  u;
+    char            model[128];
+    char            gov[64];
+    char            cur[32];
+    char            max[32];
+    char            sib[128];
+    int             cpu;
+    int             turbo = bench_turbo();
+    int             siblings;
+
+    bench_env_pin();
+    cpu = g_bench_env.cpu >= 0 ? g_bench_env.cpu : sched_getcpu();
+    uname(&u);
+    bench_cpu_model(model, sizeof(model));
+    bench_read_line(gov, sizeof(gov),
+                    "/sys/devices/system/cpu/cpu%d/cpufreq/scaling_governor", cpu);
+    bench_read_line(cur, sizeof(cur),
+                    "/sys/devices/system/cpu/cpu%d/cpufreq/scaling_cur_freq", cpu);
+    bench_read_line(max, sizeof(max),
+                    "/sys/devices/system/cpu/cpu%d/cpufreq/cpuinfo_max_freq", cpu);
+    siblings = bench_smt_siblings(cpu, sib, sizeof(sib));
+
+    printf("\n%s🖥️  Environment%s\n", CLR_CYAN, CLR_RESET);
+    printf("   kernel    %s %s %s\n", u.sysname, u.release, u.machine);
+    printf("   compiler  %s\n", BENCH_COMPILER);
+    printf("   flags     %s\n", MONSTERS_CFLAGS);
+    printf("   cpu       %s, %s cpu %d, nice %d\n", model, g_bench_env.cpu >= 0
+           ? "pinned to" : "not pinned, on", cpu, getpriority(PRIO_PROCESS, 0));
+    if (*gov)
+        printf("   freq      %s governor, %ld of %ld MHz, turbo %s\n", gov,
+               atol(cur) / 1000, atol(max) / 1000,
+               turbo < 0 ? "unknown" : turbo ? "on" : "off");
+    else
+        printf("   freq      no cpufreq in /sys (VM?), turbo %s\n",
+               turbo < 0 ? "unknown" : turbo ? "on" : "off");
+    if (siblings)
+        printf("   smt       shares its core with cpu %s\n", sib);
+    else
+        printf("   smt       no sibling thread on its core\n");
+    printf("   cv-max    %.1f%% run to run\n", g_bench_env.cv_max);
+    if (g_bench_env.profile)
+    {
+        printf("   profile   %s\n", g_bench_env.profile);
+        prof_open(g_bench_env.profile, g_bench_env.profile_hz, g_bench_env.profile_only);
+    }
+    if (*gov && strcmp(gov, "performance") != 0)
+        bench_warn("frequency governor is not 'performance': clocks ramp during the run");
+    if (turbo > 0)
+        bench_warn("turbo is on: the clock depends on temperature and the other cores");
+    if (siblings)
+        bench_warn("an SMT sibling is online: whatever runs there shares this core");
+    if (g_bench_env.profile)
+        bench_warn("profiling: timings include the sampling overhead");
+    metric("env.cpu", cpu, "cpu");
+    metric("env.turbo", turbo, "bool");
+    metric("env.smt_siblings", siblings, "count");
+    metric("env.nice", getpriority(PRIO_PROCESS, 0), "nice");
+    if (*cur)
+        metric("env.freq", atol(cur) / 1000, "MHz");
+}
+
+/* Call before summary(): how many measurements were too noisy to trust */
+static inline void bench_env_end(void)
+{
+    metric("env.noisy", g_bench_env.noisy, "count");
+    metric("env.cv_worst", g_bench_env.worst_cv[0], "%");
+    if (!g_bench_env.noisy)
+    {
+        printf("\n%s📐 run-to-run variation under %.1f%% in all %d measurements%s\n",
+               CLR_GREEN, g_bench_env.cv_max, g_bench_env.checked, CLR_RESET);
+        return ;
+    }
+    printf("\n%s⚠ %d of %d measurements vary more than %.1f%% between runs; "
+           "do not trust small differences:%s\n", CLR_YELLOW, g_bench_env.noisy,
+           g_bench_env.checked, g_bench_env.cv_max, CLR_RESET);
+    for (int i = 0; i < BENCH_NOISY_SHOWN && g_bench_env.worst[i][0]; i++)
+        printf("%s   %-40s %6.1f%%%s\n", CLR_YELLOW, g_bench_env.worst[i],
+               g_bench_env.worst_cv[i], CLR_RESET);
+}
+
+#endif
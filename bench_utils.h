@@ -0,0 +1,156 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_utils.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BENCH_UTILS_H
+# define BENCH_UTILS_H
+
+# include <time.h>
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include "test_utils.h"
+# include "alloc_hooks.h"
+
+/* ⏱️ Monotonic clock in nanoseconds */
+static inline uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/* 🎲 xorshift64*: fast, seedable and identical on every platform */
+static inline uint64_t bench_rand64(uint64_t *state)
+{
+    uint64_t x = *state;
+
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+    return x * 0x2545F4914F6CDD1Dull;
+}
+
+/* 🔢 Parses counts such as "1000000", "1e7" or "4M" / "64K" / "1G" */
+static inline double bench_parse_count(const char *s)
+{
+    char    *end;
+    double  v = strtod(s, &end);
+
+    if (*end == 'K' || *end == 'k')
+        v *= 1024;
+    else if (*end == 'M' || *end == 'm')
+        v *= 1024 * 1024;
+    else if (*end == 'G' || *end == 'g')
+        v *= 1024.0 * 1024 * 1024;
+    return v;
+}
+
+/* 📏 "512 B", "4 KiB", "64 MiB", "1 GiB" */
+static inline const char *bench_fmt_bytes(char *buf, size_t size, double bytes)
+{
+    const char  *units[] = {"B", "KiB", "MiB", "GiB", "TiB"};
+    int         u = 0;
+
+    while (bytes >= 1024 && u < 4)
+    {
+        bytes /= 1024;
+        u++;
+    }
+    snprintf(buf, size, bytes == (long)bytes ? "%.0f %s" : "%.1f %s", bytes, units[u]);
+    return buf;
+}
+
+/* 🗂️ Corpus files written by monsters_corpus (`make corpus`) into
+ *    $MONSTERS_CORPUS (default build/corpus). Each holds its data and a
+ *    trailing NUL. They are mapped read-only and shared: every process
+ *    and worker reading the same file reads the same page-cache pages.
+ *    Callers pass lengths; a benchmark that needs a NUL before the end
+ *    of the file, or writes into its input, works on bench_work_copy(). */
+# define CORPUS_DEFAULT_DIR "build/corpus"
+
+typedef struct s_corpus
+{
+    const char  *data;
+    size_t      len;
+}   t_corpus;
+
+static inline const char *bench_corpus_dir(void)
+{
+    const char *dir = getenv("MONSTERS_CORPUS");
+
+    return dir && *dir ? dir : CORPUS_DEFAULT_DIR;
+}
+
+/* Returns 0 (and leaves c empty) if the file is missing or unusable */
+static inline int bench_corpus_open(t_corpus *c, const char *name)
+{
+    char        path[PATH_MAX];
+    struct stat st;
+    int         fd;
+    void        *map = MAP_FAILED;
+
+    c->data = NULL;
+    c->len = 0;
+    snprintf(path, sizeof(path), "%s/%s", bench_corpus_dir(), name);
+    if ((fd = open(path, O_RDONLY)) < 0)
+        return 0;
+    if (fstat(fd, &st) == 0 && st.st_size > 1)
+        map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        return 0;
+    c->data = map;
+    c->len = st.st_size - 1;
+    return 1;
+}
+
+static inline void bench_corpus_close(t_corpus *c)
+{
+    if (c->data)
+        munmap((void *)c->data, c->len + 1);
+    c->data = NULL;
+    c->len = 0;
+}
+
+/* The first n bytes of src and a NUL, in fresh private anonymous pages
+ * (src may be a corpus mapping); NULL when out of memory */
+static inline char *bench_work_copy(const char *src, size_t n)
+{
+    char *buf = mmap(NULL, n + 1, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (buf == MAP_FAILED)
+        return NULL;
+    memcpy(buf, src, n);
+    buf[n] = '\0';
+    return buf;
+}
+
+static inline void bench_work_free(char *buf, size_t n)
+{
+    if (buf)
+        munmap(buf, n + 1);
+}
+
+/* 📋 Section headers in the same style as the test suites */
+static inline void bench_section(const char *name)
+{
+    printf("\n%s=== %s ===%s\n", CLR_YELLOW, name, CLR_RESET);
+}
+
+static inline void bench_warn(const char *msg)
+{
+    printf("%s  ⚠ %s%s\n", CLR_YELLOW, msg, CLR_RESET);
+}
+
+#endif
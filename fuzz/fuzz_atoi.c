@@ -0,0 +1,52 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuzz_atoi.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fuzz_utils.h"
+
+/* atoi's rules in the C locale. Results outside int are undefined for
+ * atoi too, so those inputs are only run, not checked. */
+static int ref_atoi(const char *s, int *in_range)
+{
+    long long   v = 0;
+    int         neg = 0;
+
+    *in_range = 1;
+    while (*s == ' ' || (*s >= '\t' && *s <= '\r'))
+        s++;
+    if (*s == '-' || *s == '+')
+        neg = *s++ == '-';
+    while (*s >= '0' && *s <= '9')
+    {
+        v = v * 10 + (*s++ - '0');
+        if (v > (long long)INT_MAX + 1)
+        {
+            *in_range = 0;
+            return 0;
+        }
+    }
+    if (!neg && v > INT_MAX)
+        *in_range = 0;
+    return (int)(neg ? -v : v);
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    t_fuzz_in   in = {data, size};
+    char        *s = fuzz_str(&in);
+    int         in_range;
+    int         expect = ref_atoi(s, &in_range);
+    int         got = ft_atoi(s);
+
+    if (in_range)
+        FUZZ_CHECK(got == expect, "ft_atoi");
+    free(s);
+    return 0;
+}
@@ -0,0 +1,46 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuzz_calloc.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fuzz_utils.h"
+
+#define MAX_BYTES   (1u << 20)
+
+/* ft_calloc. Input: count and size (4 bytes each; a high bit set in the
+ * first byte scales count up to near SIZE_MAX, to reach the overflow
+ * check). Products past SIZE_MAX must give NULL; up to MAX_BYTES the
+ * block must be zeroed and fully writable. */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    t_fuzz_in   in = {data, size};
+    int         huge = size && data[0] & 0x80;
+    size_t      count = fuzz_u32(&in);
+    size_t      sz = fuzz_u32(&in);
+    uint8_t     *p;
+
+    if (huge)
+        count = SIZE_MAX / (count | 1) * 3;
+    if (sz && count > SIZE_MAX / sz)
+    {
+        p = ft_calloc(count, sz);
+        FUZZ_CHECK(p == NULL, "ft_calloc");
+        return 0;
+    }
+    if (count * sz > MAX_BYTES)
+        return 0;
+    p = ft_calloc(count, sz);
+    if (!p)
+        return 0;
+    for (size_t i = 0; i < count * sz; i++)
+        FUZZ_CHECK(p[i] == 0, "ft_calloc");
+    memset(p, 0xAB, count * sz);
+    free(p);
+    return 0;
+}
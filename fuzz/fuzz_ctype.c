@@ -0,0 +1,41 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuzz_ctype.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fuzz_utils.h"
+
+/* ft_is* and ft_to* on every byte value in the input, and on every
+ * 4-byte chunk read as an int (outside the ASCII range nothing matches
+ * and ft_toupper/ft_tolower return their argument unchanged) */
+static void check(int c)
+{
+    int upper = c >= 'A' && c <= 'Z';
+    int lower = c >= 'a' && c <= 'z';
+    int digit = c >= '0' && c <= '9';
+
+    FUZZ_CHECK(!ft_isalpha(c) == !(upper || lower), "ft_isalpha");
+    FUZZ_CHECK(!ft_isdigit(c) == !digit, "ft_isdigit");
+    FUZZ_CHECK(!ft_isalnum(c) == !(upper || lower || digit), "ft_isalnum");
+    FUZZ_CHECK(!ft_isascii(c) == !(c >= 0 && c <= 127), "ft_isascii");
+    FUZZ_CHECK(!ft_isprint(c) == !(c >= 32 && c <= 126), "ft_isprint");
+    FUZZ_CHECK(ft_toupper(c) == (lower ? c - 32 : c), "ft_toupper");
+    FUZZ_CHECK(ft_tolower(c) == (upper ? c + 32 : c), "ft_tolower");
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    t_fuzz_in in = {data, size};
+
+    for (size_t i = 0; i < size; i++)
+        check(data[i]);
+    while (in.size >= 4)
+        check((int)fuzz_u32(&in));
+    return 0;
+}
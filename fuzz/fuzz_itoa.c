@@ -0,0 +1,30 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuzz_itoa.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fuzz_utils.h"
+
+/* ft_itoa on every 4-byte chunk of the input, against snprintf */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    t_fuzz_in   in = {data, size};
+    char        expect[16];
+
+    while (in.size >= 4)
+    {
+        int     n = (int)fuzz_u32(&in);
+        char    *s = ft_itoa(n);
+
+        snprintf(expect, sizeof(expect), "%d", n);
+        FUZZ_CHECK(s && strcmp(s, expect) == 0, "ft_itoa");
+        free(s);
+    }
+    return 0;
+}
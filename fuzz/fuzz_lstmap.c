@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuzz_lstmap.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fuzz_utils.h"
+
+/* Node contents are malloc'ed ints, so LeakSanitizer sees any node or
+ * content that ft_lstmap, ft_lstdelone or ft_lstclear forgets */
+static void *map_twice(void *content)
+{
+    int *copy = malloc(sizeof(*copy));
+
+    if (copy)
+        *copy = (int)(*(unsigned int *)content * 2u);
+    return copy;
+}
+
+static void bump(void *content)
+{
+    (*(unsigned int *)content)++;
+}
+
+/* The list decoded from the input: each 4-byte chunk is one value, and
+ * its lowest bit chooses ft_lstadd_back or ft_lstadd_front. ref holds
+ * the values in list order. */
+static t_list *decode(t_fuzz_in *in, int *ref, size_t *n)
+{
+    t_list *lst = NULL;
+
+    *n = 0;
+    while (in->size >= 4)
+    {
+        int     *v = malloc(sizeof(*v));
+        t_list  *node;
+
+        if (!v)
+            abort();
+        *v = (int)fuzz_u32(in);
+        node = ft_lstnew(v);
+        FUZZ_CHECK(node && node->content == v && !node->next, "ft_lstnew");
+        if (*v & 1)
+        {
+            ft_lstadd_back(&lst, node);
+            ref[(*n)++] = *v;
+        }
+        else
+        {
+            ft_lstadd_front(&lst, node);
+            memmove(ref + 1, ref, *n * sizeof(*ref));
+            ref[0] = *v;
+            (*n)++;
+        }
+    }
+    return lst;
+}
+
+/* ft_lstnew/add_front/add_back/size/last/iter/map/delone/clear over one
+ * decoded list */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    t_fuzz_in   in = {data, size};
+    int         *ref = malloc((size / 4 + 1) * sizeof(*ref));
+    size_t      n;
+    t_list      *lst;
+    t_list      *mapped;
+    t_list      *p;
+
+    if (!ref)
+        return 0;
+    lst = decode(&in, ref, &n);
+    FUZZ_CHECK(ft_lstsize(lst) == (int)n, "ft_lstsize");
+    FUZZ_CHECK(n ? *(int *)ft_lstlast(lst)->content == ref[n - 1]
+               : ft_lstlast(lst) == NULL, "ft_lstlast");
+    ft_lstiter(lst, bump);
+    mapped = ft_lstmap(lst, map_twice, free);
+    FUZZ_CHECK(ft_lstsize(mapped) == (int)n, "ft_lstmap");
+    p = mapped;
+    for (size_t i = 0; i < n; i++, p = p->next)
+        FUZZ_CHECK(*(int *)p->content == (int)((ref[i] + 1u) * 2u), "ft_lstmap");
+    if (lst)
+    {
+        p = lst->next;
+        ft_lstdelone(lst, free);
+        lst = p;
+    }
+    ft_lstclear(&lst, free);
+    FUZZ_CHECK(lst == NULL, "ft_lstclear");
+    ft_lstclear(&mapped, free);
+    free(ref);
+    return 0;
+}
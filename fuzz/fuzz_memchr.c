@@ -0,0 +1,28 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuzz_memchr.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fuzz_utils.h"
+
+/* ft_memchr over a buffer of exactly n bytes (reading past n is an ASan
+ * error even when c is not there). Input: c (4 bytes), then the buffer. */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    t_fuzz_in   in = {data, size};
+    int         c = (int)fuzz_u32(&in);
+    uint8_t     *buf = malloc(in.size ? in.size : 1);
+
+    if (!buf)
+        return 0;
+    memcpy(buf, in.data, in.size);
+    FUZZ_CHECK(ft_memchr(buf, c, in.size) == memchr(buf, c, in.size), "ft_memchr");
+    free(buf);
+    return 0;
+}
@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuzz_memcmp.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fuzz_utils.h"
+
+static int sign(int v)
+{
+    return (v > 0) - (v < 0);
+}
+
+/* ft_memcmp on two exact-size buffers and ft_strncmp on the same bytes as
+ * strings. Input: n (2 bytes), then a and b split at the first 0x00. */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    t_fuzz_in   in = {data, size};
+    size_t      n = fuzz_u16(&in);
+    char        *a;
+    char        *b;
+    size_t      common;
+    char        *ma;
+    char        *mb;
+
+    fuzz_two_strs(&in, &a, &b);
+    common = strlen(a) < strlen(b) ? strlen(a) : strlen(b);
+    FUZZ_CHECK(sign(ft_strncmp(a, b, n)) == sign(strncmp(a, b, n)), "ft_strncmp");
+    ma = malloc(common ? common : 1);
+    mb = malloc(common ? common : 1);
+    if (ma && mb)
+    {
+        memcpy(ma, a, common);
+        memcpy(mb, b, common);
+        n = common ? n % (common + 1) : 0;
+        FUZZ_CHECK(sign(ft_memcmp(ma, mb, n)) == sign(memcmp(ma, mb, n)), "ft_memcmp");
+    }
+    free(ma);
+    free(mb);
+    free(a);
+    free(b);
+    return 0;
+}
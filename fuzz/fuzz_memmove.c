@@ -0,0 +1,47 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuzz_memmove.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fuzz_utils.h"
+
+/* ft_memmove between overlapping ranges of one buffer, both directions,
+ * and ft_memcpy into a separate buffer. Input: src offset, dst offset
+ * and n (2 bytes each, wrapped into the buffer), then the buffer. */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    t_fuzz_in   in = {data, size};
+    size_t      src = fuzz_u16(&in);
+    size_t      dst = fuzz_u16(&in);
+    size_t      n = fuzz_u16(&in);
+    size_t      len = in.size;
+    uint8_t     *buf = malloc(len ? len : 1);
+    uint8_t     *ref = malloc(len ? len : 1);
+
+    if (!buf || !ref || !len)
+    {
+        free(buf);
+        free(ref);
+        return 0;
+    }
+    src %= len;
+    dst %= len;
+    n %= len - (src > dst ? src : dst) + 1;
+    memcpy(buf, in.data, len);
+    memcpy(ref, in.data, len);
+    memmove(ref + dst, ref + src, n);
+    FUZZ_CHECK(ft_memmove(buf + dst, buf + src, n) == buf + dst, "ft_memmove");
+    FUZZ_CHECK(memcmp(buf, ref, len) == 0, "ft_memmove");
+    memset(buf, 0, len);
+    FUZZ_CHECK(ft_memcpy(buf, in.data + src, n) == buf, "ft_memcpy");
+    FUZZ_CHECK(memcmp(buf, in.data + src, n) == 0, "ft_memcpy");
+    free(buf);
+    free(ref);
+    return 0;
+}
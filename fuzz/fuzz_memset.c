@@ -0,0 +1,37 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuzz_memset.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fuzz_utils.h"
+
+/* ft_memset and ft_bzero on a buffer of exactly the input's size, so a
+ * write past n is caught by ASan. Input: c (4 bytes), n (2 bytes, at
+ * most the buffer size), then the buffer's initial bytes. */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    t_fuzz_in   in = {data, size};
+    int         c = (int)fuzz_u32(&in);
+    size_t      n = fuzz_u16(&in);
+    uint8_t     *buf = malloc(in.size ? in.size : 1);
+
+    if (!buf)
+        return 0;
+    n = in.size ? n % (in.size + 1) : 0;
+    memcpy(buf, in.data, in.size);
+    FUZZ_CHECK(ft_memset(buf, c, n) == buf, "ft_memset");
+    for (size_t i = 0; i < in.size; i++)
+        FUZZ_CHECK(buf[i] == (i < n ? (uint8_t)c : in.data[i]), "ft_memset");
+    memcpy(buf, in.data, in.size);
+    ft_bzero(buf, n);
+    for (size_t i = 0; i < in.size; i++)
+        FUZZ_CHECK(buf[i] == (i < n ? 0 : in.data[i]), "ft_bzero");
+    free(buf);
+    return 0;
+}
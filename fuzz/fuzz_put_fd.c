@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuzz_put_fd.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <fcntl.h>
+#include "fuzz_utils.h"
+
+#define INPUT_MAX   4096
+
+/* Everything written so far, read back from the non-blocking pipe */
+static size_t drain(int fd, char *buf, size_t size)
+{
+    size_t  got = 0;
+    ssize_t n;
+
+    while (got < size && (n = read(fd, buf + got, size - got)) > 0)
+        got += n;
+    return got;
+}
+
+/* ft_putchar_fd, ft_putstr_fd, ft_putendl_fd and ft_putnbr_fd into a
+ * pipe. Input: n (4 bytes), then s (the first byte is also the char). */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    static int  fds[2] = {-1, -1};
+    static char out[2 * INPUT_MAX + 64];
+    t_fuzz_in   in = {data, size < INPUT_MAX ? size : INPUT_MAX};
+    int         n = (int)fuzz_u32(&in);
+    char        *s = fuzz_str(&in);
+    size_t      len = strlen(s);
+    char        expect[16];
+    size_t      elen = snprintf(expect, sizeof(expect), "%d", n);
+
+    if (fds[0] < 0 && (pipe(fds) < 0 || fcntl(fds[0], F_SETFL, O_NONBLOCK) < 0))
+        abort();
+    ft_putchar_fd(s[0], fds[1]);
+    FUZZ_CHECK(drain(fds[0], out, sizeof(out)) == 1 && out[0] == s[0], "ft_putchar_fd");
+    ft_putstr_fd(s, fds[1]);
+    FUZZ_CHECK(drain(fds[0], out, sizeof(out)) == len && memcmp(out, s, len) == 0,
+               "ft_putstr_fd");
+    ft_putendl_fd(s, fds[1]);
+    FUZZ_CHECK(drain(fds[0], out, sizeof(out)) == len + 1
+               && memcmp(out, s, len) == 0 && out[len] == '\n', "ft_putendl_fd");
+    ft_putnbr_fd(n, fds[1]);
+    FUZZ_CHECK(drain(fds[0], out, sizeof(out)) == elen && memcmp(out, expect, elen) == 0,
+               "ft_putnbr_fd");
+    free(s);
+    return 0;
+}
@@ -0,0 +1,47 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuzz_split.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fuzz_utils.h"
+
+/* ft_split, checked word by word. Input: the delimiter (1 byte, 0x00
+ * included), then s. */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    t_fuzz_in   in = {data, size};
+    char        c = (char)fuzz_byte(&in);
+    char        *s = fuzz_str(&in);
+    char        **tab = ft_split(s, c);
+    size_t      w = 0;
+
+    FUZZ_CHECK(tab != NULL, "ft_split");
+    for (const char *p = s; *p;)
+    {
+        size_t len = 0;
+
+        if (*p == c)
+        {
+            p++;
+            continue ;
+        }
+        while (p[len] && p[len] != c)
+            len++;
+        FUZZ_CHECK(tab[w] != NULL, "ft_split");
+        FUZZ_CHECK(strncmp(tab[w], p, len) == 0 && tab[w][len] == '\0', "ft_split");
+        w++;
+        p += len;
+    }
+    FUZZ_CHECK(tab[w] == NULL, "ft_split");
+    for (size_t i = 0; tab[i]; i++)
+        free(tab[i]);
+    free(tab);
+    free(s);
+    return 0;
+}
@@ -0,0 +1,27 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuzz_strchr.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fuzz_utils.h"
+
+/* ft_strlen, ft_strchr and ft_strrchr. Input: c (4 bytes, any int: only
+ * (char)c counts, and c == '\0' finds the terminator), then s. */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    t_fuzz_in   in = {data, size};
+    int         c = (int)fuzz_u32(&in);
+    char        *s = fuzz_str(&in);
+
+    FUZZ_CHECK(ft_strlen(s) == strlen(s), "ft_strlen");
+    FUZZ_CHECK(ft_strchr(s, c) == strchr(s, (char)c), "ft_strchr");
+    FUZZ_CHECK(ft_strrchr(s, c) == strrchr(s, (char)c), "ft_strrchr");
+    free(s);
+    return 0;
+}
@@ -0,0 +1,33 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuzz_strjoin.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fuzz_utils.h"
+
+/* ft_strjoin. Input: s1 and s2 split at the first 0x00. */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    t_fuzz_in   in = {data, size};
+    char        *a;
+    char        *b;
+    char        *joined;
+    size_t      alen;
+
+    fuzz_two_strs(&in, &a, &b);
+    alen = strlen(a);
+    joined = ft_strjoin(a, b);
+    FUZZ_CHECK(joined != NULL, "ft_strjoin");
+    FUZZ_CHECK(strncmp(joined, a, alen) == 0 && strcmp(joined + alen, b) == 0,
+               "ft_strjoin");
+    free(joined);
+    free(a);
+    free(b);
+    return 0;
+}
@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuzz_strlcpy.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fuzz_utils.h"
+
+/* BSD semantics, written out: glibc only has strlcpy/strlcat from 2.38 */
+static size_t ref_strlcpy(char *dst, const char *src, size_t size)
+{
+    size_t len = strlen(src);
+
+    if (size)
+    {
+        size_t n = len < size - 1 ? len : size - 1;
+
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return len;
+}
+
+static size_t ref_strlcat(char *dst, const char *src, size_t size)
+{
+    size_t dlen = 0;
+
+    while (dlen < size && dst[dlen])
+        dlen++;
+    if (dlen == size)
+        return size + strlen(src);
+    return dlen + ref_strlcpy(dst + dlen, src, size - dlen);
+}
+
+/* ft_strlcpy and ft_strlcat into buffers of exactly `size` bytes. For
+ * ft_strlcat dst starts as the given string padded with NULs, or with
+ * 'y' (no NUL at all) when its length is odd. Input: size (1 byte), then
+ * the initial dst and src split at the first 0x00. */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    t_fuzz_in   in = {data, size};
+    size_t      dsize = fuzz_byte(&in);
+    char        *init;
+    char        *src;
+    char        *dst = malloc(dsize ? dsize : 1);
+    char        *ref = malloc(dsize ? dsize : 1);
+
+    fuzz_two_strs(&in, &init, &src);
+    if (dst && ref)
+    {
+        memset(dst, 'x', dsize);
+        memset(ref, 'x', dsize);
+        FUZZ_CHECK(ft_strlcpy(dst, src, dsize) == ref_strlcpy(ref, src, dsize),
+                   "ft_strlcpy");
+        FUZZ_CHECK(memcmp(dst, ref, dsize) == 0, "ft_strlcpy");
+        for (size_t i = 0; i < dsize; i++)
+            dst[i] = i < strlen(init) ? init[i] : strlen(init) % 2 ? 'y' : '\0';
+        memcpy(ref, dst, dsize);
+        FUZZ_CHECK(ft_strlcat(dst, src, dsize) == ref_strlcat(ref, src, dsize),
+                   "ft_strlcat");
+        FUZZ_CHECK(memcmp(dst, ref, dsize) == 0, "ft_strlcat");
+    }
+    free(dst);
+    free(ref);
+    free(init);
+    free(src);
+    return 0;
+}
@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuzz_strmapi.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fuzz_utils.h"
+
+/* The callbacks mix in the index, so a wrong or repeated index shows up
+ * in the output (never as a NUL); the key comes from the input */
+static uint8_t      g_key;
+static unsigned int g_next;
+static int          g_in_order;
+
+static char map(unsigned int i, char c)
+{
+    char out = c ^ (char)(i * 31 + g_key);
+
+    g_in_order &= i == g_next++;
+    return out ? out : c;
+}
+
+static void iter(unsigned int i, char *c)
+{
+    *c = map(i, *c);
+}
+
+/* ft_strmapi and ft_striteri. Input: key (1 byte), then s. */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    t_fuzz_in   in = {data, size};
+    char        *s;
+    char        *expect;
+    char        *mapped;
+    size_t      len;
+
+    g_key = fuzz_byte(&in);
+    s = fuzz_str(&in);
+    len = strlen(s);
+    expect = strdup(s);
+    if (!expect)
+        abort();
+    for (size_t i = 0; i < len; i++)
+        expect[i] = map(i, s[i]);
+    g_next = 0;
+    g_in_order = 1;
+    mapped = ft_strmapi(s, map);
+    FUZZ_CHECK(mapped && strcmp(mapped, expect) == 0, "ft_strmapi");
+    FUZZ_CHECK(g_in_order && g_next == len, "ft_strmapi");
+    g_next = 0;
+    ft_striteri(s, iter);
+    FUZZ_CHECK(strcmp(s, expect) == 0, "ft_striteri");
+    FUZZ_CHECK(g_in_order && g_next == len, "ft_striteri");
+    free(mapped);
+    free(expect);
+    free(s);
+    return 0;
+}
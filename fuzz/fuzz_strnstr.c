@@ -0,0 +1,41 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuzz_strnstr.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fuzz_utils.h"
+
+static char *ref_strnstr(const char *big, const char *little, size_t len)
+{
+    size_t n = strlen(little);
+
+    if (!n)
+        return (char *)big;
+    for (size_t i = 0; big[i] && i + n <= len; i++)
+        if (strncmp(big + i, little, n) == 0)
+            return (char *)big + i;
+    return NULL;
+}
+
+/* ft_strnstr. Input: len (2 bytes), then big and little split at the
+ * first 0x00. */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    t_fuzz_in   in = {data, size};
+    size_t      len = fuzz_u16(&in);
+    char        *big;
+    char        *little;
+
+    fuzz_two_strs(&in, &big, &little);
+    FUZZ_CHECK(ft_strnstr(big, little, len) == ref_strnstr(big, little, len),
+               "ft_strnstr");
+    free(big);
+    free(little);
+    return 0;
+}
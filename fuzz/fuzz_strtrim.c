@@ -0,0 +1,38 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuzz_strtrim.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fuzz_utils.h"
+
+/* ft_strtrim. Input: s1 and set split at the first 0x00. */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    t_fuzz_in   in = {data, size};
+    char        *s;
+    char        *set;
+    char        *trimmed;
+    size_t      b = 0;
+    size_t      e;
+
+    fuzz_two_strs(&in, &s, &set);
+    e = strlen(s);
+    while (s[b] && strchr(set, s[b]))
+        b++;
+    while (e > b && strchr(set, s[e - 1]))
+        e--;
+    trimmed = ft_strtrim(s, set);
+    FUZZ_CHECK(trimmed != NULL, "ft_strtrim");
+    FUZZ_CHECK(strlen(trimmed) == e - b && memcmp(trimmed, s + b, e - b) == 0,
+               "ft_strtrim");
+    free(trimmed);
+    free(s);
+    free(set);
+    return 0;
+}
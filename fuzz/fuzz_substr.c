@@ -0,0 +1,34 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuzz_substr.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "fuzz_utils.h"
+
+/* ft_substr. Input: start and len (4 bytes each; start past the end
+ * gives ""), then s. */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    t_fuzz_in       in = {data, size};
+    unsigned int    start = fuzz_u32(&in);
+    size_t          len = fuzz_u32(&in);
+    char            *s = fuzz_str(&in);
+    size_t          slen = strlen(s);
+    size_t          n = start >= slen ? 0 : slen - start;
+    char            *sub = ft_substr(s, start, len);
+
+    if (n > len)
+        n = len;
+    FUZZ_CHECK(sub != NULL, "ft_substr");
+    FUZZ_CHECK(strlen(sub) == n && memcmp(sub, s + (n ? start : 0), n) == 0,
+               "ft_substr");
+    free(sub);
+    free(s);
+    return 0;
+}
@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuzz_utils.h                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FUZZ_UTILS_H
+# define FUZZ_UTILS_H
+
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <stdint.h>
+# include <limits.h>
+# include "libft.h"
+
+/* 🐛 Every fuzz_*.c file is one target: it defines the libFuzzer entry
+ *    point below, which is also what standalone.c (gcc, AFL, replaying
+ *    crash files) calls. Inputs are arbitrary bytes; each target decodes
+ *    the arguments it needs from them and checks the result against a
+ *    reference. A failed check aborts, which every fuzzer records as a
+ *    crash together with the input. */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+# define FUZZ_CHECK(cond, fn) \
+    do { if (!(cond)) fuzz_fail(fn, #cond, __FILE__, __LINE__); } while (0)
+
+static inline void fuzz_fail(const char *fn, const char *cond,
+                             const char *file, int line)
+{
+    fprintf(stderr, "💥 %s: check failed: %s (%s:%d)\n", fn, cond, file, line);
+    abort();
+}
+
+/* 📥 Arguments are taken from the front of the input; whatever is left
+ *    over becomes the string or buffer under test. Missing bytes read
+ *    as 0, so every input decodes to something. */
+typedef struct s_fuzz_in
+{
+    const uint8_t   *data;
+    size_t          size;
+}   t_fuzz_in;
+
+static inline uint8_t fuzz_byte(t_fuzz_in *in)
+{
+    if (!in->size)
+        return 0;
+    in->size--;
+    return *in->data++;
+}
+
+static inline uint16_t fuzz_u16(t_fuzz_in *in)
+{
+    uint16_t hi = fuzz_byte(in);
+
+    return hi << 8 | fuzz_byte(in);
+}
+
+static inline uint32_t fuzz_u32(t_fuzz_in *in)
+{
+    uint32_t v = 0;
+
+    for (int i = 0; i < 4; i++)
+        v = v << 8 | fuzz_byte(in);
+    return v;
+}
+
+/* The rest of the input as a malloc'ed string (cut at an embedded NUL) */
+static inline char *fuzz_str(t_fuzz_in *in)
+{
+    char *s = malloc(in->size + 1);
+
+    if (!s)
+        abort();
+    memcpy(s, in->data, in->size);
+    s[in->size] = '\0';
+    in->data += in->size;
+    in->size = 0;
+    return s;
+}
+
+/* The rest of the input as two strings, split at its first 0x00 byte */
+static inline void fuzz_two_strs(t_fuzz_in *in, char **a, char **b)
+{
+    const uint8_t   *nul = memchr(in->data, 0, in->size);
+    size_t          len = nul ? (size_t)(nul - in->data) : in->size;
+    t_fuzz_in       head = {in->data, len};
+
+    *a = fuzz_str(&head);
+    in->data += len + (nul != NULL);
+    in->size -= len + (nul != NULL);
+    *b = fuzz_str(in);
+}
+
+#endif
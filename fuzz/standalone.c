@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   standalone.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include "fuzz_utils.h"
+
+/* main() for the targets when libFuzzer is not linked in: gcc builds,
+ * AFL (afl-gcc feeds the input on stdin or as a file) and replaying a
+ * corpus or a crash file. With --random it runs its own dumb fuzzer,
+ * biased towards the bytes libft cares about. */
+#define INPUT_MAX   (1ul << 20)
+
+static uint8_t  g_buf[INPUT_MAX];
+
+static size_t run_fd(FILE *fp)
+{
+    size_t len = fread(g_buf, 1, sizeof(g_buf), fp);
+
+    LLVMFuzzerTestOneInput(g_buf, len);
+    return len;
+}
+
+static int run_path(const char *path, unsigned long *runs)
+{
+    struct stat st;
+    DIR         *dir;
+    FILE        *fp;
+
+    if (stat(path, &st) < 0)
+    {
+        perror(path);
+        return -1;
+    }
+    if (S_ISDIR(st.st_mode))
+    {
+        struct dirent   *e;
+        char            child[PATH_MAX];
+        int             status = 0;
+
+        if (!(dir = opendir(path)))
+        {
+            perror(path);
+            return -1;
+        }
+        while ((e = readdir(dir)))
+        {
+            if (e->d_name[0] == '.')
+                continue ;
+            snprintf(child, sizeof(child), "%s/%s", path, e->d_name);
+            status |= run_path(child, runs);
+        }
+        closedir(dir);
+        return status;
+    }
+    if (!(fp = fopen(path, "rb")))
+    {
+        perror(path);
+        return -1;
+    }
+    run_fd(fp);
+    fclose(fp);
+    (*runs)++;
+    return 0;
+}
+
+static uint64_t next_rand(uint64_t *state)
+{
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/* Half the bytes come from a small alphabet (separators, signs, digits,
+ * NUL), so splits, trims and numbers actually get exercised */
+static void run_random(unsigned long runs, size_t max_len, uint64_t seed)
+{
+    static const char   alphabet[] = " ,-+0123456789abc\t\n";
+
+    for (unsigned long r = 0; r < runs; r++)
+    {
+        size_t len = max_len ? next_rand(&seed) % (max_len + 1) : 0;
+
+        for (size_t i = 0; i < len; i++)
+        {
+            uint64_t x = next_rand(&seed);
+
+            g_buf[i] = x & 1 ? (uint8_t)(x >> 8)
+                     : (uint8_t)alphabet[(x >> 8) % sizeof(alphabet)];
+        }
+        LLVMFuzzerTestOneInput(g_buf, len);
+    }
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [FILE|DIR]...\n"
+                    "       %s --random N [--max-len L] [--seed S]\n"
+                    "  with no argument the input is read from stdin\n",
+            prog, prog);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long   runs = 0;
+    unsigned long   random_runs = 0;
+    size_t          max_len = 64;
+    uint64_t        seed = 1;
+    int             status = 0;
+    int             files = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--random") == 0 && i + 1 < argc)
+            random_runs = strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "--max-len") == 0 && i + 1 < argc)
+            max_len = strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            seed = strtoull(argv[++i], NULL, 0);
+        else if (argv[i][0] == '-' && argv[i][1])
+        {
+            usage(argv[0]);
+            return (2);
+        }
+        else
+            files++;
+    }
+    if (max_len > INPUT_MAX)
+        max_len = INPUT_MAX;
+    for (int i = 1; i < argc; i++)
+    {
+        if (argv[i][0] == '-' && argv[i][1])
+            i++;
+        else if (strcmp(argv[i], "-") == 0)
+            runs += (run_fd(stdin), 1);
+        else
+            status |= run_path(argv[i], &runs);
+    }
+    if (!files && !random_runs)
+        runs += (run_fd(stdin), 1);
+    run_random(random_runs, max_len, seed);
+    fprintf(stderr, "✅ %s: %lu inputs, no failure\n", argv[0],
+            runs + random_runs);
+    return (status ? 1 : 0);
+}
@@ -0,0 +1,551 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   monsters_ab.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "bench_env.h"
+
+int tests_run = 0;
+int tests_passed = 0;
+
+/* 🔀 Two libft builds in one binary (`make ab AB_B=<tree>`): A keeps its
+ *    names, every symbol of B was prefixed with b_ by tools/ab_prefix.sh.
+ *    Each function first runs on the same inputs in A and B and the
+ *    outputs must match. Then A and B are timed in interleaved rounds,
+ *    the order flipping every round, and the B/A speedup is the geometric
+ *    mean of the per-round ratios with a 95% confidence interval: drift
+ *    in clock speed or cache state hits both sides of a round alike. */
+#ifndef MONSTERS_AB_A
+# define MONSTERS_AB_A "A"
+#endif
+#ifndef MONSTERS_AB_B
+# define MONSTERS_AB_B "B"
+#endif
+#define DEFAULT_MAX_BYTES   (64ul << 10)
+#define MIN_BYTES           16ul
+#define SIZE_STEP           16
+#define DEFAULT_ROUNDS      30
+#define DEFAULT_MIN_EFFECT  2.0
+#define BATCH_NS            2000000ull
+#define CHECK_SIZES         12
+#define NUM_COUNT           16
+
+#define AB_FUNCS(X) X(ft_memset) X(ft_bzero) X(ft_memcpy) X(ft_memmove) \
+    X(ft_memchr) X(ft_memcmp) X(ft_strlen) X(ft_strlcpy) X(ft_strlcat) \
+    X(ft_strncmp) X(ft_strchr) X(ft_strrchr) X(ft_strnstr) X(ft_atoi) \
+    X(ft_strdup) X(ft_substr) X(ft_strjoin) X(ft_strtrim) X(ft_split) \
+    X(ft_itoa) X(ft_strmapi)
+#define AB_DECLARE(fn) extern __typeof__(fn) b_##fn;
+#define AB_FIELD(fn) __typeof__(fn) *fn;
+#define AB_A_FN(fn) fn,
+#define AB_B_FN(fn) b_##fn,
+
+AB_FUNCS(AB_DECLARE)
+
+/* Both sides call through the same pointers, so the code around the
+ * call is the same machine code for A and B */
+typedef struct s_ab_fns
+{
+    AB_FUNCS(AB_FIELD)
+}   t_ab_fns;
+
+static const t_ab_fns   g_fns[2] = {{AB_FUNCS(AB_A_FN)}, {AB_FUNCS(AB_B_FN)}};
+
+typedef struct s_ab_ctx
+{
+    const t_ab_fns  *f;
+    char            *src;
+    char            *dst;
+    char            *twin;
+    size_t          n;
+    volatile uint64_t   out;
+}   t_ab_ctx;
+
+/* ========== Inputs and outputs ========== */
+
+/* Words and spaces, with the one '#' of the buffer as its last byte;
+ * twin is the same text ending in '$' instead, so comparing the two has
+ * to read all n bytes */
+static void ab_fill(t_ab_ctx *ctx)
+{
+    static const char   words[] = "lorem ipsum dolor sit amet consectetur ";
+
+    for (size_t i = 0; i < ctx->n; i++)
+        ctx->src[i] = words[i % (sizeof(words) - 1)];
+    if (ctx->n)
+        ctx->src[ctx->n - 1] = '#';
+    ctx->src[ctx->n] = '\0';
+    memcpy(ctx->twin, ctx->src, ctx->n + 1);
+    if (ctx->n)
+        ctx->twin[ctx->n - 1] = '$';
+    memset(ctx->dst, 0x55, ctx->n + 1);
+}
+
+/* FNV-1a, to compare whatever a function allocated */
+static uint64_t ab_hash(uint64_t h, const void *p, size_t n)
+{
+    const unsigned char *c = p;
+
+    for (size_t i = 0; i < n; i++)
+        h = (h ^ c[i]) * 0x100000001B3ull;
+    return h;
+}
+
+static uint64_t ab_str(char *s)
+{
+    uint64_t h = s ? ab_hash(0xCBF29CE484222325ull, s, strlen(s) + 1) : 0;
+
+    free(s);
+    return h;
+}
+
+static uint64_t ab_offset(const void *p, const void *base)
+{
+    return p ? (uint64_t)((const char *)p - (const char *)base) : UINT64_MAX;
+}
+
+static char ab_upper(unsigned int i, char c)
+{
+    (void)i;
+    return c >= 'a' && c <= 'z' ? c - 32 : c;
+}
+
+static const char   *g_nums[NUM_COUNT] = {
+    "0", "-1", "42", "  +17", "\t\n-2147483648", "2147483647", "007", "-0",
+    "123abc", "  -99 9", "+-3", "", "65536", "-100000", "  \v8", "1234567890"};
+
+static const int    g_ints[NUM_COUNT] = {
+    0, -1, 42, 17, INT_MIN, INT_MAX, 7, 100, -99, 65536, -100000, 8, 10, -10,
+    1234567890, -987654321};
+
+/* ========== Cases ========== */
+
+typedef struct s_ab_case
+{
+    const char  *name;
+    const char  *key;
+    int         sized;
+    void        (*run)(t_ab_ctx *ctx);
+}   t_ab_case;
+
+static void run_memset(t_ab_ctx *c)
+{
+    c->out = ab_offset(c->f->ft_memset(c->dst, 'x', c->n), c->dst);
+}
+
+static void run_bzero(t_ab_ctx *c)
+{
+    c->f->ft_bzero(c->dst, c->n);
+    c->out = 1;
+}
+
+static void run_memcpy(t_ab_ctx *c)
+{
+    c->out = ab_offset(c->f->ft_memcpy(c->dst, c->src, c->n), c->dst);
+}
+
+/* Overlapping, destination after the source: the backward copy */
+static void run_memmove(t_ab_ctx *c)
+{
+    c->out = ab_offset(c->f->ft_memmove(c->src + 1, c->src,
+                                               c->n ? c->n - 1 : 0), c->src);
+}
+
+static void run_memchr(t_ab_ctx *c)
+{
+    c->out = ab_offset(c->f->ft_memchr(c->src, '#', c->n), c->src);
+}
+
+/* Only the sign of a comparison is specified: -1/0/1 is as right as
+ * the difference of the bytes */
+static uint64_t ab_sign(int cmp)
+{
+    return (uint64_t)((cmp > 0) - (cmp < 0));
+}
+
+static void run_memcmp(t_ab_ctx *c)
+{
+    c->out = ab_sign(c->f->ft_memcmp(c->src, c->twin, c->n));
+}
+
+static void run_strlen(t_ab_ctx *c)
+{
+    c->out = c->f->ft_strlen(c->src);
+}
+
+static void run_strlcpy(t_ab_ctx *c)
+{
+    c->out = c->f->ft_strlcpy(c->dst, c->src, c->n / 2 + 1);
+}
+
+static void run_strlcat(t_ab_ctx *c)
+{
+    c->dst[c->n / 2] = '\0';
+    c->out = c->f->ft_strlcat(c->dst, c->src, c->n + 1);
+}
+
+static void run_strncmp(t_ab_ctx *c)
+{
+    c->out = ab_sign(c->f->ft_strncmp(c->src, c->twin, c->n));
+}
+
+static void run_strchr(t_ab_ctx *c)
+{
+    c->out = ab_offset(c->f->ft_strchr(c->src, '#'), c->src);
+}
+
+static void run_strrchr(t_ab_ctx *c)
+{
+    c->out = ab_offset(c->f->ft_strrchr(c->src, 'l'), c->src);
+}
+
+/* The last word and its '#': found only at the very end */
+static void run_strnstr(t_ab_ctx *c)
+{
+    const char *needle = c->n >= 6 ? c->src + c->n - 6 : "";
+
+    c->out = ab_offset(c->f->ft_strnstr(c->src, needle, c->n), c->src);
+}
+
+static void run_atoi(t_ab_ctx *c)
+{
+    uint64_t sum = 0;
+
+    for (int i = 0; i < NUM_COUNT; i++)
+        sum = sum * 31 + (uint64_t)c->f->ft_atoi(g_nums[i]);
+    c->out = sum;
+}
+
+static void run_strdup(t_ab_ctx *c)
+{
+    c->out = ab_str(c->f->ft_strdup(c->src));
+}
+
+static void run_substr(t_ab_ctx *c)
+{
+    c->out = ab_str(c->f->ft_substr(c->src, c->n / 4, c->n / 2));
+}
+
+static void run_strjoin(t_ab_ctx *c)
+{
+    c->out = ab_str(c->f->ft_strjoin(c->src, c->src + c->n / 2));
+}
+
+static void run_strtrim(t_ab_ctx *c)
+{
+    c->out = ab_str(c->f->ft_strtrim(c->src, "# lor"));
+}
+
+static void run_split(t_ab_ctx *c)
+{
+    char        **tab = c->f->ft_split(c->src, ' ');
+    uint64_t    h = 0xCBF29CE484222325ull;
+
+    for (size_t i = 0; tab && tab[i]; i++)
+    {
+        h = ab_hash(h, tab[i], strlen(tab[i]) + 1);
+        free(tab[i]);
+    }
+    free(tab);
+    c->out = tab ? h : 0;
+}
+
+static void run_itoa(t_ab_ctx *c)
+{
+    uint64_t h = 0;
+
+    for (int i = 0; i < NUM_COUNT; i++)
+        h = h * 31 + ab_str(c->f->ft_itoa(g_ints[i]));
+    c->out = h;
+}
+
+static void run_strmapi(t_ab_ctx *c)
+{
+    c->out = ab_str(c->f->ft_strmapi(c->src, ab_upper));
+}
+
+static const t_ab_case  g_cases[] = {
+    {"ft_memset", "memset", 1, run_memset},
+    {"ft_bzero", "bzero", 1, run_bzero},
+    {"ft_memcpy", "memcpy", 1, run_memcpy},
+    {"ft_memmove", "memmove", 1, run_memmove},
+    {"ft_memchr", "memchr", 1, run_memchr},
+    {"ft_memcmp", "memcmp", 1, run_memcmp},
+    {"ft_strlen", "strlen", 1, run_strlen},
+    {"ft_strlcpy", "strlcpy", 1, run_strlcpy},
+    {"ft_strlcat", "strlcat", 1, run_strlcat},
+    {"ft_strncmp", "strncmp", 1, run_strncmp},
+    {"ft_strchr", "strchr", 1, run_strchr},
+    {"ft_strrchr", "strrchr", 1, run_strrchr},
+    {"ft_strnstr", "strnstr", 1, run_strnstr},
+    {"ft_atoi", "atoi", 0, run_atoi},
+    {"ft_strdup", "strdup", 1, run_strdup},
+    {"ft_substr", "substr", 1, run_substr},
+    {"ft_strjoin", "strjoin", 1, run_strjoin},
+    {"ft_strtrim", "strtrim", 1, run_strtrim},
+    {"ft_split", "split", 1, run_split},
+    {"ft_itoa", "itoa", 0, run_itoa},
+    {"ft_strmapi", "strmapi", 1, run_strmapi},
+};
+
+#define CASE_COUNT  (sizeof(g_cases) / sizeof(*g_cases))
+
+/* ========== Cross-check ========== */
+
+/* One call per side on freshly filled buffers; the return value and
+ * both buffers must come out the same. Returns the first size that
+ * differs, or -1. */
+static long ab_check(const t_ab_case *tc, t_ab_ctx *ctx, char *save, size_t max)
+{
+    static const size_t sizes[CHECK_SIZES] = {0, 1, 2, 7, 8, 9, 15, 16, 17,
+                                              63, 255, 4097};
+
+    for (int i = 0; i < (tc->sized ? CHECK_SIZES : 1); i++)
+    {
+        uint64_t    out;
+
+        ctx->n = sizes[i] < max ? sizes[i] : max;
+        ctx->f = &g_fns[0];
+        ab_fill(ctx);
+        tc->run(ctx);
+        out = ctx->out;
+        memcpy(save, ctx->src, ctx->n + 1);
+        memcpy(save + ctx->n + 1, ctx->dst, ctx->n + 1);
+        ctx->f = &g_fns[1];
+        ab_fill(ctx);
+        tc->run(ctx);
+        if (out != ctx->out || memcmp(save, ctx->src, ctx->n + 1) != 0
+            || memcmp(save + ctx->n + 1, ctx->dst, ctx->n + 1) != 0)
+            return (long)ctx->n;
+    }
+    return -1;
+}
+
+/* ========== Interleaved timing ========== */
+
+/* Two-sided 95% quantile of Student's t */
+static double t95(int df)
+{
+    static const double t[] = {12.71, 4.30, 3.18, 2.78, 2.57, 2.45, 2.36,
+                               2.31, 2.26, 2.23};
+
+    if (df < 1)
+        return INFINITY;
+    return df <= 10 ? t[df - 1] : 1.96 + 2.4 / df;
+}
+
+static double ab_batch(const t_ab_case *tc, t_ab_ctx *ctx, int side, long iters)
+{
+    uint64_t t0;
+
+    ctx->f = &g_fns[side];
+    t0 = bench_now_ns();
+    for (long i = 0; i < iters; i++)
+        tc->run(ctx);
+    return (double)(bench_now_ns() - t0) / iters;
+}
+
+typedef struct s_ab_result
+{
+    double  ns[2];
+    double  speedup;
+    double  lo;
+    double  hi;
+}   t_ab_result;
+
+/* Round r runs A then B when r is even, B then A when it is odd */
+static t_ab_result ab_time(const t_ab_case *tc, t_ab_ctx *ctx, int rounds)
+{
+    t_ab_result     res = {{-1, -1}, 0, 0, 0};
+    t_bench_runs    runs[2] = {{0, 0, 0}, {0, 0, 0}};
+    t_bench_runs    ratio = {0, 0, 0};
+    uint64_t        t0 = bench_now_ns();
+    uint64_t        probe;
+    long            iters;
+    char            key[64];
+
+    ab_fill(ctx);
+    ctx->f = &g_fns[0];
+    tc->run(ctx);
+    probe = bench_now_ns() - t0;
+    iters = probe ? (long)(BATCH_NS / probe) : 1000;
+    if (iters < 1)
+        iters = 1;
+    ab_batch(tc, ctx, 1, iters);
+    for (int r = 0; r < rounds; r++)
+    {
+        double ns[2];
+
+        ns[r & 1] = ab_batch(tc, ctx, r & 1, iters);
+        ns[!(r & 1)] = ab_batch(tc, ctx, !(r & 1), iters);
+        for (int s = 0; s < 2; s++)
+        {
+            bench_runs_add(&runs[s], ns[s]);
+            if (res.ns[s] < 0 || ns[s] < res.ns[s])
+                res.ns[s] = ns[s];
+        }
+        if (ns[0] > 0 && ns[1] > 0)
+            bench_runs_add(&ratio, log(ns[0] / ns[1]));
+    }
+    for (int s = 0; s < 2; s++)
+    {
+        snprintf(key, sizeof(key), "%s %zu %c", tc->name, ctx->n, s ? 'B' : 'A');
+        bench_check_cv(key, &runs[s]);
+    }
+    double half = ratio.n > 1
+        ? t95(ratio.n - 1) * sqrt(ratio.m2 / (ratio.n - 1) / ratio.n) : INFINITY;
+    res.speedup = exp(ratio.mean);
+    res.lo = exp(ratio.mean - half);
+    res.hi = exp(ratio.mean + half);
+    return res;
+}
+
+/* A difference counts when the whole interval is beyond --min-effect
+ * percent: an A/A run (the same tree twice) still shows a few percent
+ * between two copies of identical code */
+static double   g_min_effect = DEFAULT_MIN_EFFECT;
+
+static void print_result(const char *name, size_t n, int sized, const t_ab_result *r)
+{
+    char        size[32] = "-";
+    const char  *clr = CLR_RESET;
+    const char  *verdict = "no difference";
+
+    if (sized)
+        bench_fmt_bytes(size, sizeof(size), n);
+    if (r->lo > 1 + g_min_effect / 100)
+    {
+        clr = CLR_GREEN;
+        verdict = "B faster";
+    }
+    else if (r->hi < 1 - g_min_effect / 100)
+    {
+        clr = CLR_RED;
+        verdict = "B slower";
+    }
+    printf("%-12s %9s │ %10.1f %10.1f │ %s%6.3fx [%.3f, %.3f]  %s%s\n", name,
+           size, r->ns[0], r->ns[1], clr, r->speedup, r->lo, r->hi, verdict,
+           CLR_RESET);
+}
+
+/* ========== Main Benchmark Runner ========== */
+
+static int selected(const char *only, const char *key)
+{
+    const char  *p = only;
+    size_t      len = strlen(key);
+
+    while (p && *p)
+    {
+        if (strncmp(p, key, len) == 0 && (p[len] == ',' || p[len] == '\0'))
+            return 1;
+        p = strchr(p, ',');
+        p = p ? p + 1 : NULL;
+    }
+    return !only;
+}
+
+static void ab_case(const t_ab_case *tc, t_ab_ctx *ctx, char *save,
+                    size_t max_bytes, int rounds)
+{
+    char        msg[160];
+    long        bad = ab_check(tc, ctx, save, max_bytes);
+
+    if (bad >= 0)
+    {
+        printf("%-12s %9s │ %s%s%s\n", tc->name, "", CLR_RED,
+               "A and B disagree, not timed", CLR_RESET);
+        snprintf(msg, sizeof(msg), "%s: A and B give different results (n=%ld)",
+                 tc->name, bad);
+        result_ko(msg);
+        return ;
+    }
+    tests_run++;
+    tests_passed++;
+    for (size_t n = MIN_BYTES; n <= max_bytes; n *= SIZE_STEP)
+    {
+        t_ab_result r;
+
+        ctx->n = tc->sized ? n : 0;
+        r = ab_time(tc, ctx, rounds);
+        print_result(tc->name, ctx->n, tc->sized, &r);
+        if (!tc->sized)
+        {
+            snprintf(msg, sizeof(msg), "ab.%s", tc->key);
+            metric(msg, r.speedup, "x");
+            break ;
+        }
+        snprintf(msg, sizeof(msg), "ab.%s.%zu", tc->key, n);
+        metric(msg, r.speedup, "x");
+    }
+}
+
+static void usage(const char *prog)
+{
+    printf("usage: %s [--max-bytes N] [--rounds N] [--min-effect P] "
+           "[--only strlen,split,...]\n"
+           "       [--cpu N] [--priority] [--cv-max P]\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+    size_t      max_bytes = DEFAULT_MAX_BYTES;
+    int         rounds = DEFAULT_ROUNDS;
+    const char  *only = NULL;
+    t_ab_ctx    ctx;
+    char        *save;
+
+    setvbuf(stdout, NULL, _IONBF, 0);
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--max-bytes") == 0 && i + 1 < argc)
+            max_bytes = (size_t)bench_parse_count(argv[++i]);
+        else if (strcmp(argv[i], "--rounds") == 0 && i + 1 < argc)
+            rounds = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--min-effect") == 0 && i + 1 < argc)
+            g_min_effect = atof(argv[++i]);
+        else if (strcmp(argv[i], "--only") == 0 && i + 1 < argc)
+            only = argv[++i];
+        else if (!bench_env_arg(argc, argv, &i))
+        {
+            usage(argv[0]);
+            return (2);
+        }
+    }
+    if (rounds < 2)
+        rounds = 2;
+    if (max_bytes < MIN_BYTES)
+        max_bytes = MIN_BYTES;
+    ctx.src = malloc(max_bytes + 1);
+    ctx.dst = malloc(max_bytes + 1);
+    ctx.twin = malloc(max_bytes + 1);
+    save = malloc(2 * (max_bytes + 1));
+    if (!ctx.src || !ctx.dst || !ctx.twin || !save)
+        return (1);
+
+    part_header("A/B: two libft builds, interleaved");
+    bench_env_begin();
+    printf("\n   A  %s\n   B  %s (symbols prefixed with b_)\n", MONSTERS_AB_A,
+           MONSTERS_AB_B);
+    bench_section("B/A speedup per call, 95% confidence interval");
+    printf("%s%-12s %9s │ %10s %10s │ %s (%d rounds)%s\n", CLR_BOLD, "function",
+           "bytes", "A ns", "B ns", "speedup", rounds, CLR_RESET);
+    for (size_t i = 0; i < CASE_COUNT; i++)
+        if (selected(only, g_cases[i].key))
+            ab_case(&g_cases[i], &ctx, save, max_bytes, rounds);
+
+    free(ctx.src);
+    free(ctx.dst);
+    free(ctx.twin);
+    free(save);
+    bench_env_end();
+    summary();
+    return (tests_run == tests_passed ? 0 : 1);
+}
@@ -0,0 +1,734 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   monsters_alloc.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include "bench_env.h"
+
+int tests_run = 0;
+int tests_passed = 0;
+
+/* 🧮 Allocator sensitivity (`make alloc`): the allocating functions run
+ *    under glibc malloc, under a bump arena plugged into the link-time
+ *    malloc wrappers (alloc_set_backend), and under every jemalloc or
+ *    tcmalloc found on the machine, each loaded with LD_PRELOAD into a
+ *    re-executed copy of this binary. The time inside the allocator is
+ *    measured by replaying the malloc/free sequence one call made, with
+ *    no libft code in between; the rest of the call is the function. */
+#define SIZE_COUNT      3
+#define DEFAULT_REPS    3
+#define RUN_BUDGET_NS   100000000ull
+#define ARENA_BYTES     (256ul << 20)
+#define ARENA_ALIGN     16
+#define TRACE_MAX       (1 << 20)
+#define MAX_ALLOCATORS  8
+#define SHARE_BAR       20
+
+static const size_t g_sizes[SIZE_COUNT] = {64, 1024, 16384};
+
+/* ========== Bump arena backend ========== */
+
+/* malloc moves a pointer, free does nothing, and the whole arena is
+ * dropped after each call of the workload. Every block starts with its
+ * size, for realloc. Blocks from before the switch go back to libc. */
+void    *__real_malloc(size_t size);
+void    __real_free(void *ptr);
+
+typedef struct s_arena
+{
+    char    *base;
+    size_t  used;
+}   t_arena;
+
+static t_arena  g_arena;
+
+static void *arena_malloc(size_t size)
+{
+    size_t  need = (size + 2 * ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+    char    *p;
+
+    if (!g_arena.base || need > ARENA_BYTES - g_arena.used)
+        return NULL;
+    p = g_arena.base + g_arena.used;
+    g_arena.used += need;
+    *(size_t *)p = size;
+    return p + ARENA_ALIGN;
+}
+
+static int arena_owns(const void *ptr)
+{
+    return (const char *)ptr >= g_arena.base
+        && (const char *)ptr < g_arena.base + ARENA_BYTES;
+}
+
+static void arena_free(void *ptr)
+{
+    if (ptr && !arena_owns(ptr))
+        __real_free(ptr);
+}
+
+static void *arena_realloc(void *ptr, size_t size)
+{
+    void    *res;
+    size_t  old;
+
+    if (ptr && !arena_owns(ptr))
+        return NULL;
+    if (!(res = arena_malloc(size)))
+        return NULL;
+    old = ptr ? *(size_t *)((char *)ptr - ARENA_ALIGN) : 0;
+    if (ptr)
+        memcpy(res, ptr, old < size ? old : size);
+    return res;
+}
+
+static const t_alloc_backend    g_arena_backend = {arena_malloc, arena_free,
+                                                   arena_realloc};
+
+static void arena_reset(void)
+{
+    g_arena.used = 0;
+}
+
+/* ========== Allocation traces ========== */
+
+/* While recording, every block carries its id and size in front of it;
+ * free() logs that id, so the replay knows which of its blocks to free */
+enum { OP_MALLOC, OP_FREE };
+
+typedef struct s_op
+{
+    int     kind;
+    int     id;
+    size_t  size;
+}   t_op;
+
+typedef struct s_trace
+{
+    t_op    *ops;
+    size_t  n;
+    int     blocks;
+    int     full;
+}   t_trace;
+
+static t_trace  g_rec;
+
+static void *rec_malloc(size_t size)
+{
+    char *p = __real_malloc(size + ARENA_ALIGN);
+
+    if (!p)
+        return NULL;
+    if (g_rec.n < TRACE_MAX)
+        g_rec.ops[g_rec.n++] = (t_op){OP_MALLOC, g_rec.blocks, size};
+    else
+        g_rec.full = 1;
+    *(int *)p = g_rec.blocks++;
+    *(size_t *)(p + sizeof(size_t)) = size;
+    return p + ARENA_ALIGN;
+}
+
+static void rec_free(void *ptr)
+{
+    char *p = (char *)ptr - ARENA_ALIGN;
+
+    if (!ptr)
+        return ;
+    if (g_rec.n < TRACE_MAX)
+        g_rec.ops[g_rec.n++] = (t_op){OP_FREE, *(int *)p, 0};
+    else
+        g_rec.full = 1;
+    __real_free(p);
+}
+
+/* libft has no realloc; logged as a malloc and a free all the same */
+static void *rec_realloc(void *ptr, size_t size)
+{
+    char    *res = rec_malloc(size);
+    size_t  old;
+
+    if (res && ptr)
+    {
+        old = *(size_t *)((char *)ptr - sizeof(size_t));
+        memcpy(res, ptr, old < size ? old : size);
+        rec_free(ptr);
+    }
+    return res;
+}
+
+static const t_alloc_backend    g_rec_backend = {rec_malloc, rec_free, rec_realloc};
+
+typedef struct s_replay
+{
+    const t_trace   *trace;
+    void            **ptrs;
+    int             arena;
+}   t_replay;
+
+static void replay_run(void *arg)
+{
+    t_replay    *r = arg;
+    const t_op  *op = r->trace->ops;
+
+    for (size_t i = 0; i < r->trace->n; i++)
+    {
+        if (op[i].kind == OP_MALLOC)
+            r->ptrs[op[i].id] = malloc(op[i].size);
+        else
+            free(r->ptrs[op[i].id]);
+    }
+    if (r->arena)
+        arena_reset();
+}
+
+/* ========== Workloads ========== */
+
+enum { W_SPLIT, W_STRJOIN, W_ITOA, W_LSTNEW, W_LSTMAP, W_COUNT };
+
+static const struct
+{
+    const char  *name;
+    const char  *key;
+    const char  *unit;
+}   g_works[W_COUNT] = {
+    {"ft_split", "split", "bytes"},
+    {"ft_strjoin", "strjoin", "bytes"},
+    {"ft_itoa", "itoa", "numbers"},
+    {"ft_lstnew", "lstnew", "nodes"},
+    {"ft_lstmap", "lstmap", "nodes"},
+};
+
+typedef struct s_work
+{
+    int             kind;
+    size_t          n;
+    char            *text;
+    size_t          words;
+    char            **strs;
+    t_list          *list;
+    int             arena;
+    volatile int    ok;
+}   t_work;
+
+static void del_nothing(void *content)
+{
+    (void)content;
+}
+
+static void *map_same(void *content)
+{
+    return content;
+}
+
+/* One call of the workload, everything it allocated freed again */
+static void work_run(void *arg)
+{
+    t_work  *w = arg;
+    int     ok = 1;
+
+    if (w->kind == W_SPLIT)
+    {
+        char    **tab = ft_split(w->text, ' ');
+        size_t  i = 0;
+
+        while (tab && tab[i])
+            free(tab[i++]);
+        ok = tab && i == w->words;
+        free(tab);
+    }
+    else if (w->kind == W_STRJOIN)
+    {
+        char *s = ft_strjoin(w->text, w->text + w->n / 2 + 1);
+
+        ok = s && s[w->n - 1] != '\0' && s[w->n] == '\0';
+        free(s);
+    }
+    else if (w->kind == W_ITOA)
+    {
+        for (size_t i = 0; i < w->n; i++)
+            ok &= (w->strs[i] = ft_itoa((int)(i * 2654435761u))) != NULL;
+        for (size_t i = 0; i < w->n; i++)
+            free(w->strs[i]);
+    }
+    else if (w->kind == W_LSTNEW)
+    {
+        t_list *lst = NULL;
+
+        for (size_t i = 0; i < w->n; i++)
+        {
+            t_list *node = ft_lstnew((void *)(i + 1));
+
+            ok &= node != NULL;
+            if (node)
+                ft_lstadd_front(&lst, node);
+        }
+        ft_lstclear(&lst, del_nothing);
+    }
+    else
+    {
+        t_list *mapped = ft_lstmap(w->list, map_same, del_nothing);
+
+        ok = mapped && ft_lstsize(mapped) == (int)w->n;
+        ft_lstclear(&mapped, del_nothing);
+    }
+    w->ok = ok;
+    if (w->arena)
+        arena_reset();
+}
+
+static int work_setup(t_work *w, int kind, size_t n)
+{
+    static const char   words[] = "lorem ipsum dolor sit amet consectetur ";
+
+    memset(w, 0, sizeof(*w));
+    w->kind = kind;
+    w->n = n;
+    if (kind == W_SPLIT || kind == W_STRJOIN)
+    {
+        if (!(w->text = malloc(n + 2)))
+            return 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            w->text[i] = words[i % (sizeof(words) - 1)];
+            w->words += w->text[i] != ' ' && (i == 0 || w->text[i - 1] == ' ');
+        }
+        w->text[n] = '\0';
+        /* strjoin joins the two halves: "<n/2 bytes>\0<n - n/2 bytes>\0" */
+        if (kind == W_STRJOIN)
+        {
+            memmove(w->text + n / 2 + 1, w->text + n / 2, n - n / 2 + 1);
+            w->text[n / 2] = '\0';
+        }
+    }
+    else if (kind == W_ITOA)
+        return (w->strs = malloc(n * sizeof(*w->strs))) != NULL;
+    else if (kind == W_LSTMAP)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            t_list *node = ft_lstnew((void *)(i + 1));
+
+            if (!node)
+                return 0;
+            ft_lstadd_front(&w->list, node);
+        }
+    }
+    return 1;
+}
+
+static void work_teardown(t_work *w)
+{
+    free(w->text);
+    free(w->strs);
+    ft_lstclear(&w->list, del_nothing);
+}
+
+/* ========== Measurements ========== */
+
+static double batch_ns(void (*run)(void *), void *ctx, long iters)
+{
+    uint64_t t0 = bench_now_ns();
+
+    for (long it = 0; it < iters; it++)
+        run(ctx);
+    return (double)(bench_now_ns() - t0) / iters;
+}
+
+/* Best ns per call of the workload and of its replay; the two alternate
+ * batch by batch, so a slow stretch of the machine hits both alike */
+static void best_pair(t_work *w, t_replay *r, int reps, const char *what,
+                      double *total, double *alloc)
+{
+    uint64_t        t0 = bench_now_ns();
+    uint64_t        probe;
+    long            iters;
+    t_bench_runs    runs[2] = {{0, 0, 0}, {0, 0, 0}};
+    char            msg[112];
+
+    work_run(w);
+    probe = bench_now_ns() - t0;
+    iters = probe ? (long)(RUN_BUDGET_NS / 2 / reps / probe) : 1000;
+    if (iters < 1)
+        iters = 1;
+    *total = -1;
+    *alloc = -1;
+    for (int rep = 0; rep < reps; rep++)
+    {
+        double ns = batch_ns(work_run, w, iters);
+
+        if (*total < 0 || ns < *total)
+            *total = ns;
+        bench_runs_add(&runs[0], ns);
+        ns = batch_ns(replay_run, r, iters);
+        if (*alloc < 0 || ns < *alloc)
+            *alloc = ns;
+        bench_runs_add(&runs[1], ns);
+    }
+    bench_check_cv(what, &runs[0]);
+    snprintf(msg, sizeof(msg), "%s replay", what);
+    bench_check_cv(msg, &runs[1]);
+}
+
+typedef struct s_cell
+{
+    double  total;
+    double  alloc;
+    double  mallocs;
+    int     ok;
+}   t_cell;
+
+/* What one allocator gives for every workload and size; also what a
+ * re-executed copy sends back through its pipe */
+typedef struct s_alloc_result
+{
+    char    name[32];
+    char    owner[64];
+    t_cell  cell[W_COUNT][SIZE_COUNT];
+}   t_alloc_result;
+
+/* Records the calls of one workload call, then times the workload and the
+ * replay with the current allocator (arena: the bump arena) */
+static t_cell measure(int kind, size_t n, int arena, int reps, const char *name)
+{
+    t_cell      c = {-1, -1, 0, 0};
+    t_work      w;
+    t_replay    r = {&g_rec, NULL, arena};
+    char        what[96];
+
+    if (!work_setup(&w, kind, n))
+    {
+        work_teardown(&w);
+        return c;
+    }
+    g_rec.n = 0;
+    g_rec.blocks = 0;
+    g_rec.full = 0;
+    alloc_set_backend(&g_rec_backend);
+    work_run(&w);
+    alloc_set_backend(NULL);
+    c.ok = w.ok && !g_rec.full;
+    c.mallocs = g_rec.blocks;
+    if (c.ok && (r.ptrs = malloc((g_rec.blocks + 1) * sizeof(*r.ptrs))))
+    {
+        w.arena = arena;
+        snprintf(what, sizeof(what), "%s %zu %s", g_works[kind].name, n, name);
+        alloc_set_backend(arena ? &g_arena_backend : NULL);
+        best_pair(&w, &r, reps, what, &c.total, &c.alloc);
+        c.ok = w.ok;
+        alloc_set_backend(NULL);
+        free(r.ptrs);
+    }
+    work_teardown(&w);
+    return c;
+}
+
+/* The library that malloc resolves to in this process */
+static void malloc_owner(char *buf, size_t size)
+{
+    void    *fn = dlsym(RTLD_DEFAULT, "malloc");
+    Dl_info info;
+
+    snprintf(buf, size, "?");
+    if (fn && dladdr(fn, &info) && info.dli_fname)
+        snprintf(buf, size, "%s", strrchr(info.dli_fname, '/')
+                 ? strrchr(info.dli_fname, '/') + 1 : info.dli_fname);
+}
+
+static void measure_all(t_alloc_result *res, const char *name, int arena, int reps)
+{
+    memset(res, 0, sizeof(*res));
+    snprintf(res->name, sizeof(res->name), "%s", name);
+    malloc_owner(res->owner, sizeof(res->owner));
+    if (arena)
+        snprintf(res->owner, sizeof(res->owner), "alloc_set_backend");
+    for (int k = 0; k < W_COUNT; k++)
+        for (int s = 0; s < SIZE_COUNT; s++)
+            res->cell[k][s] = measure(k, g_sizes[s], arena, reps, name);
+}
+
+/* ========== LD_PRELOAD allocators ========== */
+
+typedef struct s_preload
+{
+    const char  *name;
+    const char  *path;
+}   t_preload;
+
+static const char   *g_lib_dirs[] = {
+    "/usr/lib/x86_64-linux-gnu", "/usr/lib/aarch64-linux-gnu", "/usr/lib64",
+    "/usr/lib", "/usr/local/lib", NULL};
+
+static const t_preload  g_known[] = {
+    {"jemalloc", "libjemalloc.so.2"},
+    {"tcmalloc", "libtcmalloc_minimal.so.4"},
+    {"tcmalloc", "libtcmalloc.so.4"},
+    {NULL, NULL}};
+
+/* The first copy of each known library found in the usual directories */
+static int find_preloads(t_preload *out, int n, char paths[][PATH_MAX])
+{
+    for (int k = 0; g_known[k].name && n < MAX_ALLOCATORS; k++)
+    {
+        int seen = 0;
+
+        for (int i = 0; i < n; i++)
+            seen |= strcmp(out[i].name, g_known[k].name) == 0;
+        for (int d = 0; g_lib_dirs[d] && !seen; d++)
+        {
+            snprintf(paths[n], PATH_MAX, "%s/%s", g_lib_dirs[d], g_known[k].path);
+            if (access(paths[n], R_OK) == 0)
+            {
+                out[n] = (t_preload){g_known[k].name, paths[n]};
+                n++;
+                seen = 1;
+            }
+        }
+    }
+    return n;
+}
+
+/* Runs this binary again with LD_PRELOAD=path; the copy measures with
+ * whatever malloc now is and writes its t_alloc_result to the pipe */
+static int measure_preload(t_alloc_result *res, const t_preload *p, int reps)
+{
+    int     fds[2];
+    pid_t   pid;
+    int     status;
+    size_t  got = 0;
+    ssize_t n;
+
+    if (pipe(fds) < 0 || (pid = fork()) < 0)
+        return 0;
+    if (pid == 0)
+    {
+        char    fd[16];
+        char    r[16];
+
+        close(fds[0]);
+        snprintf(fd, sizeof(fd), "%d", fds[1]);
+        snprintf(r, sizeof(r), "%d", reps);
+        setenv("LD_PRELOAD", p->path, 1);
+        execl("/proc/self/exe", "monsters_alloc", "--child", fd, p->name,
+              "--reps", r, (char *)NULL);
+        _exit(127);
+    }
+    close(fds[1]);
+    while (got < sizeof(*res) && (n = read(fds[0], (char *)res + got,
+                                           sizeof(*res) - got)) > 0)
+        got += n;
+    close(fds[0]);
+    waitpid(pid, &status, 0);
+    return got == sizeof(*res) && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+static int child(const char *fd, const char *name, int reps)
+{
+    t_alloc_result  res;
+    size_t          sent = 0;
+    ssize_t         n;
+    int             out = atoi(fd);
+
+    measure_all(&res, name, 0, reps);
+    while (sent < sizeof(res) && (n = write(out, (char *)&res + sent,
+                                            sizeof(res) - sent)) > 0)
+        sent += n;
+    close(out);
+    return sent == sizeof(res) ? 0 : 1;
+}
+
+/* ========== Report ========== */
+
+static void print_bar(double share)
+{
+    int fill = (int)(share * SHARE_BAR + 0.5);
+
+    for (int i = 0; i < SHARE_BAR; i++)
+        printf("%s", i < fill ? "█" : "░");
+}
+
+static void report(const t_alloc_result *res, int count)
+{
+    char msg[160];
+
+    for (int k = 0; k < W_COUNT; k++)
+    {
+        snprintf(msg, sizeof(msg), "%s: time in the allocator vs in the function",
+                 g_works[k].name);
+        bench_section(msg);
+        printf("%s%8s %-9s %-10s │ %11s │ %11s %11s │ %-24s%s\n", CLR_BOLD, "n",
+               g_works[k].unit, "allocator", "ns/call", "allocator", "function",
+               "share in allocator", CLR_RESET);
+        int bad = 0;
+
+        for (int s = 0; s < SIZE_COUNT; s++)
+        {
+            for (int a = 0; a < count; a++)
+            {
+                const t_cell    *c = &res[a].cell[k][s];
+                double          in_alloc = c->alloc < c->total ? c->alloc : c->total;
+                double          share = c->total > 0 ? in_alloc / c->total : 0;
+
+                if (a == 0)
+                    printf("%8zu %-9s %-10s │ ", g_sizes[s], "", res[a].name);
+                else
+                    printf("%8s %-9s %-10s │ ", "", "", res[a].name);
+                if (!c->ok)
+                {
+                    printf("%swrong result%s\n", CLR_RED, CLR_RESET);
+                    snprintf(msg, sizeof(msg), "%s: %zu %s under %s", g_works[k].name,
+                             g_sizes[s], g_works[k].unit, res[a].name);
+                    result_ko(msg);
+                    bad = 1;
+                    continue ;
+                }
+                printf("%11.0f │ %11.0f %11.0f │ ", c->total, in_alloc,
+                       c->total - in_alloc);
+                print_bar(share);
+                printf(" %3.0f%%\n", share * 100);
+                snprintf(msg, sizeof(msg), "alloc.%s.%zu.%s", g_works[k].key,
+                         g_sizes[s], res[a].name);
+                metric(msg, c->total, "ns");
+                snprintf(msg, sizeof(msg), "alloc.%s.%zu.%s.share", g_works[k].key,
+                         g_sizes[s], res[a].name);
+                metric(msg, share * 100, "%");
+            }
+        }
+        if (!bad)
+        {
+            snprintf(msg, sizeof(msg), "%s: same result under every allocator",
+                     g_works[k].name);
+            result_ok(msg);
+        }
+        printf("%s%8s %-9s mallocs per call: %.0f at the largest size%s\n", CLR_CYAN,
+               "", "", res[0].cell[k][SIZE_COUNT - 1].mallocs, CLR_RESET);
+    }
+}
+
+/* Which lever is longer, per workload at its largest size under glibc */
+static void verdicts(const t_alloc_result *res, int count)
+{
+    printf("\n%s🧮 Verdict at the largest size%s\n", CLR_CYAN, CLR_RESET);
+    for (int k = 0; k < W_COUNT; k++)
+    {
+        const t_cell    *c = &res[0].cell[k][SIZE_COUNT - 1];
+        double          best = c->total;
+        const char      *who = res[0].name;
+        double          share;
+
+        if (!c->ok || c->total <= 0)
+            continue ;
+        for (int a = 1; a < count; a++)
+        {
+            const t_cell *o = &res[a].cell[k][SIZE_COUNT - 1];
+
+            if (o->ok && o->total > 0 && o->total < best)
+            {
+                best = o->total;
+                who = res[a].name;
+            }
+        }
+        share = c->alloc < c->total ? c->alloc / c->total : 1;
+        printf("   %-11s %3.0f%% in glibc malloc: %s; fastest: %s (%.2fx)\n",
+               g_works[k].name, share * 100, share >= 0.5
+               ? "change the allocator or allocate less"
+               : "optimize the function itself", who, c->total / best);
+    }
+}
+
+/* ========== Main Benchmark Runner ========== */
+
+static void usage(const char *prog)
+{
+    printf("usage: %s [--reps N] [--preload NAME=PATH] [--no-preload]\n"
+           "       [--cpu N] [--priority] [--cv-max P]\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+    t_alloc_result  res[MAX_ALLOCATORS];
+    t_preload       pre[MAX_ALLOCATORS];
+    char            paths[MAX_ALLOCATORS][PATH_MAX];
+    int             npre = 0;
+    int             auto_find = 1;
+    int             reps = DEFAULT_REPS;
+    int             count = 0;
+
+    setvbuf(stdout, NULL, _IONBF, 0);
+    if (!(g_rec.ops = malloc(TRACE_MAX * sizeof(*g_rec.ops))))
+        return (1);
+    g_arena.base = mmap(NULL, ARENA_BYTES, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (g_arena.base == MAP_FAILED)
+        g_arena.base = NULL;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--reps") == 0 && i + 1 < argc)
+            reps = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--child") == 0 && i + 2 < argc)
+        {
+            unsetenv("LD_PRELOAD");
+            for (int k = i + 3; k + 1 < argc; k++)
+                if (strcmp(argv[k], "--reps") == 0)
+                    reps = atoi(argv[k + 1]);
+            return child(argv[i + 1], argv[i + 2], reps < 1 ? 1 : reps);
+        }
+        else if (strcmp(argv[i], "--preload") == 0 && i + 1 < argc
+                 && strchr(argv[++i], '=') && npre < MAX_ALLOCATORS - 2)
+        {
+            *strchr(argv[i], '=') = '\0';
+            pre[npre++] = (t_preload){argv[i], argv[i] + strlen(argv[i]) + 1};
+        }
+        else if (strcmp(argv[i], "--no-preload") == 0)
+            auto_find = 0;
+        else if (!bench_env_arg(argc, argv, &i))
+        {
+            usage(argv[0]);
+            return (2);
+        }
+    }
+    if (reps < 1)
+        reps = 1;
+    if (auto_find && npre < MAX_ALLOCATORS - 2)
+        npre = find_preloads(pre, npre, paths);
+
+    part_header("BENCH: Allocator Sensitivity");
+    bench_env_begin();
+    printf("\n%s🧮 Allocators%s\n", CLR_CYAN, CLR_RESET);
+    measure_all(&res[count++], "glibc", 0, reps);
+    printf("   %-10s malloc from %s\n", res[0].name, res[0].owner);
+    if (g_arena.base)
+    {
+        measure_all(&res[count++], "arena", 1, reps);
+        printf("   %-10s bump arena behind the link-time wrappers\n", "arena");
+    }
+    for (int i = 0; i < npre; i++)
+    {
+        if (!measure_preload(&res[count], &pre[i], reps))
+            printf("%s   %-10s %s: did not run%s\n", CLR_YELLOW, pre[i].name,
+                   pre[i].path, CLR_RESET);
+        else if (!strstr(pre[i].path, res[count].owner))
+            printf("%s   %-10s %s: malloc still came from %s, skipped%s\n",
+                   CLR_YELLOW, pre[i].name, pre[i].path, res[count].owner, CLR_RESET);
+        else
+            printf("   %-10s LD_PRELOAD=%s\n", res[count++].name, pre[i].path);
+    }
+    if (!npre)
+        printf("   no jemalloc or tcmalloc found; --preload NAME=PATH adds one\n");
+    report(res, count);
+    verdicts(res, count);
+
+    if (g_arena.base)
+        munmap(g_arena.base, ARENA_BYTES);
+    free(g_rec.ops);
+    bench_env_end();
+    summary();
+    return (tests_run == tests_passed ? 0 : 1);
+}
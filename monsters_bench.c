@@ -0,0 +1,1348 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   monsters_bench.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include <math.h>
+#include "bench_env.h"
+
+int tests_run = 0;
+int tests_passed = 0;
+
+/* Sizes grow by 16x from 1 KiB up to --max-bytes. Each measurement is
+ * the best of --reps runs, and each run repeats the call until about
+ * RUN_BUDGET_NS so small sizes are not dominated by clock overhead. */
+#define DEFAULT_MAX_BYTES   (64ul << 20)
+#define DEFAULT_REPS        3
+#define MIN_BYTES           1024ul
+#define SIZE_STEP           16
+#define RUN_BUDGET_NS       200000000ull
+#define DEFAULT_SPLIT_BYTES (16ul << 20)
+#define SPLIT_TIME_LIMIT    10
+#define DEFAULT_CMP_BYTES   (64ul << 20)
+#define CMP_BAR             40
+
+/* ========== Helper Functions ========== */
+
+/* Mixed-case text so the case-toggling callbacks take both branches */
+static char *make_text(size_t n)
+{
+    static const char   words[] = "The Quick Brown Fox Jumps Over The Lazy Dog ";
+    char                *s = malloc(n + 1);
+
+    if (!s)
+        return NULL;
+    for (size_t i = 0; i < n; i++)
+        s[i] = words[i % (sizeof(words) - 1)];
+    s[n] = '\0';
+    return s;
+}
+
+/* Calls run(ctx) until the budget is used; returns the best ns per call.
+ * The spread of the repetitions is checked against --cv-max as what, and
+ * the timed loops are profiled under that name. */
+static double time_calls(void (*run)(void *), void *ctx, int reps,
+                         const char *what)
+{
+    uint64_t        t0 = bench_now_ns();
+    uint64_t        probe;
+    double          best = -1;
+    long            iters;
+    t_bench_runs    runs = {0, 0, 0};
+
+    run(ctx);
+    probe = bench_now_ns() - t0;
+    iters = probe ? (long)(RUN_BUDGET_NS / reps / probe) : 1000;
+    if (iters < 1)
+        iters = 1;
+    prof_begin(what);
+    for (int rep = 0; rep < reps; rep++)
+    {
+        t0 = bench_now_ns();
+        for (long it = 0; it < iters; it++)
+            run(ctx);
+        double ns = (double)(bench_now_ns() - t0) / iters;
+        if (best < 0 || ns < best)
+            best = ns;
+        bench_runs_add(&runs, ns);
+    }
+    prof_end();
+    bench_check_cv(what, &runs);
+    return best;
+}
+
+/* ========== ft_strmapi / ft_striteri: callback overhead ========== */
+
+/* The same case toggle as a callback and hand-inlined: the gap between
+ * the two is the price of one indirect call per byte. A strlen() in the
+ * loop condition makes ns/byte grow with the length instead. Toggling
+ * (not lowering) keeps ft_striteri's buffer mixed-case call after call,
+ * so the store branch stays as busy as in the first call. */
+static char map_same(unsigned int i, char c)
+{
+    (void)i;
+    return c;
+}
+
+static int is_letter(char c)
+{
+    return (c | 0x20) >= 'a' && (c | 0x20) <= 'z';
+}
+
+static char map_toggle(unsigned int i, char c)
+{
+    (void)i;
+    return is_letter(c) ? c ^ 0x20 : c;
+}
+
+static void iter_same(unsigned int i, char *c)
+{
+    (void)i;
+    (void)c;
+}
+
+static void iter_toggle(unsigned int i, char *c)
+{
+    (void)i;
+    if (is_letter(*c))
+        *c ^= 0x20;
+}
+
+static char *inline_mapi_toggle(const char *s)
+{
+    size_t  n = strlen(s);
+    char    *out = malloc(n + 1);
+
+    if (!out)
+        return NULL;
+    for (size_t i = 0; i < n; i++)
+        out[i] = is_letter(s[i]) ? s[i] ^ 0x20 : s[i];
+    out[n] = '\0';
+    return out;
+}
+
+static void inline_iteri_toggle(char *s)
+{
+    for (size_t i = 0; s[i]; i++)
+        if (is_letter(s[i]))
+            s[i] ^= 0x20;
+}
+
+enum { V_MAPI_SAME, V_MAPI_TOGGLE, V_MAPI_INLINE,
+       V_ITERI_SAME, V_ITERI_TOGGLE, V_ITERI_INLINE, V_COUNT };
+
+static const char *g_map_names[V_COUNT] = {
+    "ft_strmapi  identity", "ft_strmapi  toggle", "inline      toggle",
+    "ft_striteri no-op", "ft_striteri toggle", "inline      toggle",
+};
+
+typedef struct s_map_ctx
+{
+    int     variant;
+    char    *text;
+    char    *work;
+}   t_map_ctx;
+
+static void map_run(void *arg)
+{
+    t_map_ctx   *ctx = arg;
+    char        *out = NULL;
+
+    if (ctx->variant == V_MAPI_SAME)
+        out = ft_strmapi(ctx->text, map_same);
+    else if (ctx->variant == V_MAPI_TOGGLE)
+        out = ft_strmapi(ctx->text, map_toggle);
+    else if (ctx->variant == V_MAPI_INLINE)
+        out = inline_mapi_toggle(ctx->text);
+    else if (ctx->variant == V_ITERI_SAME)
+        ft_striteri(ctx->work, iter_same);
+    else if (ctx->variant == V_ITERI_TOGGLE)
+        ft_striteri(ctx->work, iter_toggle);
+    else
+        inline_iteri_toggle(ctx->work);
+    free(out);
+}
+
+/* One untimed pass with a counting callback: exactly one call per byte,
+ * with indices 0, 1, 2, ... in order */
+static unsigned long    g_calls;
+static int              g_in_order;
+
+static char map_count(unsigned int i, char c)
+{
+    g_in_order &= i == g_calls++;
+    return c;
+}
+
+static void iter_count(unsigned int i, char *c)
+{
+    (void)c;
+    g_in_order &= i == g_calls++;
+}
+
+static int check_callbacks(char *text, size_t n)
+{
+    char    *out;
+    int     ok;
+
+    g_calls = 0;
+    g_in_order = 1;
+    out = ft_strmapi(text, map_count);
+    ok = out && memcmp(out, text, n + 1) == 0 && g_calls == n && g_in_order;
+    free(out);
+    g_calls = 0;
+    ft_striteri(text, iter_count);
+    return ok && g_calls == n && g_in_order;
+}
+
+static const char *g_map_keys[V_COUNT] = {
+    "strmapi.identity", "strmapi.toggle", "strmapi.inline",
+    "striteri.noop", "striteri.toggle", "striteri.inline",
+};
+
+static void print_map_row(size_t n, int v, const double *ns)
+{
+    int     inl = v < V_ITERI_SAME ? V_MAPI_INLINE : V_ITERI_INLINE;
+    char    sz[32];
+
+    printf("%9s │ %-20s │ %8.3f %9.0f │ ", v % 3 == 0
+           ? bench_fmt_bytes(sz, sizeof(sz), n) : "", g_map_names[v],
+           ns[v], 1e3 / ns[v]);
+    if (v == inl)
+        printf("%9s\n", "-");
+    else
+        printf("%8.1fx\n", ns[v] / ns[inl]);
+    metric(g_map_keys[v], ns[v], "ns/byte");
+}
+
+/* Up to its size, the text is a prefix of the words corpus; past it, or
+ * without a corpus, it is generated here. ft_strmapi needs a NUL after n
+ * bytes and ft_striteri writes into its string, so both get their own
+ * copy and the mapping stays untouched. */
+static void map_text(t_map_ctx *ctx, const t_corpus *corpus, size_t n)
+{
+    char        *gen = NULL;
+    const char  *src = corpus->data && n <= corpus->len ? corpus->data
+        : (gen = make_text(n));
+
+    ctx->text = src ? bench_work_copy(src, n) : NULL;
+    ctx->work = src ? bench_work_copy(src, n) : NULL;
+    free(gen);
+}
+
+static void drop_text(t_map_ctx *ctx, size_t n)
+{
+    bench_work_free(ctx->text, n);
+    bench_work_free(ctx->work, n);
+}
+
+static void mapi_sweep(size_t max_bytes, int reps, const t_corpus *corpus)
+{
+    double  prev[V_COUNT] = {0};
+    char    msg[160];
+    char    sz[2][32];
+
+    for (size_t n = MIN_BYTES; n <= max_bytes; n *= SIZE_STEP)
+    {
+        t_map_ctx   ctx = {0, NULL, NULL};
+        double      ns[V_COUNT];
+        int         grows = -1;
+
+        map_text(&ctx, corpus, n);
+        if (!ctx.text || !ctx.work)
+        {
+            drop_text(&ctx, n);
+            bench_warn("out of memory, stopping");
+            break ;
+        }
+        if (!check_callbacks(ctx.text, n))
+        {
+            snprintf(msg, sizeof(msg), "ft_strmapi/ft_striteri: one callback per "
+                     "byte, in order, on %s", bench_fmt_bytes(sz[0], 32, n));
+            result_ko(msg);
+            drop_text(&ctx, n);
+            return ;
+        }
+        for (int v = 0; v < V_COUNT; v++)
+        {
+            ctx.variant = v;
+            snprintf(msg, sizeof(msg), "%s, %s", g_map_keys[v],
+                     bench_fmt_bytes(sz[0], 32, n));
+            ns[v] = time_calls(map_run, &ctx, reps, msg) / n;
+            if (prev[v] > 0 && ns[v] > 4 * prev[v] && ns[v] > 1.0 && grows < 0)
+                grows = v;
+        }
+        for (int v = 0; v < V_COUNT; v++)
+            print_map_row(n, v, ns);
+        drop_text(&ctx, n);
+        if (grows >= 0)
+        {
+            /* 16x the bytes made each byte >4x dearer: quadratic, stop here */
+            snprintf(msg, sizeof(msg), "%.*s: ns/byte grows %.0fx from %s to %s "
+                     "(strlen() in the loop condition?)",
+                     (int)strcspn(g_map_names[grows], " "), g_map_names[grows],
+                     ns[grows] / prev[grows],
+                     bench_fmt_bytes(sz[0], 32, n / SIZE_STEP),
+                     bench_fmt_bytes(sz[1], 32, n));
+            result_ko(msg);
+            return ;
+        }
+        memcpy(prev, ns, sizeof(prev));
+    }
+    result_ok("ft_strmapi/ft_striteri: linear in the string length");
+}
+
+static void bench_mapi(size_t max_bytes, int reps)
+{
+    t_corpus    corpus = {NULL, 0};
+    char        sz[32];
+
+    bench_section("ft_strmapi / ft_striteri: callback overhead");
+    if (bench_corpus_open(&corpus, "words.txt"))
+        printf("input: %s/words.txt, mapped (%s)\n", bench_corpus_dir(),
+               bench_fmt_bytes(sz, sizeof(sz), corpus.len));
+    else
+        printf("input: generated (`make corpus` to map words.txt instead)\n");
+    printf("%s%9s │ %-20s │ %8s %9s │ %9s%s\n", CLR_BOLD, "size", "variant",
+           "ns/byte", "MB/s", "vs inline", CLR_RESET);
+    mapi_sweep(max_bytes, reps, &corpus);
+    bench_corpus_close(&corpus);
+}
+
+/* ========== ft_split: adversarial inputs ========== */
+
+/* Each input runs once in its own child, so the RSS growth measured there
+ * belongs to that ft_split call alone. The byte bound is twice the least
+ * a correct ft_split must request: one pointer per word plus the NULL,
+ * and each word with its NUL. An array sized by strlen(s) instead of the
+ * word count fails it on the all-delimiters input. A child still running
+ * after SPLIT_TIME_LIMIT seconds is killed by its own alarm. The last
+ * inputs are prefixes of the mapped corpus files, when there are any. */
+enum { SPLIT_DELIMS, SPLIT_NO_DELIM, SPLIT_ALTERNATING, SPLIT_NUL,
+       SPLIT_WORDS, SPLIT_CSV, SPLIT_RUNS, SPLIT_COUNT };
+
+static const struct
+{
+    const char  *name;
+    const char  *key;
+    const char  *file;
+    char        c;
+}   g_splits[SPLIT_COUNT] = {
+    {"all delimiters", "delims", NULL, ','},
+    {"no delimiter", "no_delim", NULL, ','},
+    {"alternating a,a,", "alternating", NULL, ','},
+    {"c == '\\0'", "nul", NULL, '\0'},
+    {"words.txt, ' '", "words", "words.txt", ' '},
+    {"numbers.csv, ','", "csv", "numbers.csv", ','},
+    {"delims.txt, ','", "delim_runs", "delims.txt", ','},
+};
+
+typedef struct s_split_job
+{
+    int             kind;
+    size_t          n;
+    int             ok;
+    size_t          words;
+    size_t          expect;
+    double          least;
+    double          ms;
+    t_alloc_stats   st;
+    long            rss_kb;
+}   t_split_job;
+
+static char *make_split_input(int kind, size_t n)
+{
+    char *s = malloc(n + 1);
+
+    if (!s)
+        return NULL;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (kind == SPLIT_DELIMS)
+            s[i] = ',';
+        else if (kind == SPLIT_ALTERNATING)
+            s[i] = i % 2 ? ',' : 'a';
+        else
+            s[i] = 'a' + i % 26;
+    }
+    s[n] = '\0';
+    return s;
+}
+
+/* Words in s and the bytes they hold, counted the slow, obvious way */
+static size_t split_count(const char *s, char c, size_t *chars)
+{
+    size_t words = 0;
+
+    *chars = 0;
+    for (size_t i = 0; s[i]; i++)
+    {
+        if (s[i] == c)
+            continue ;
+        words += i == 0 || s[i - 1] == c;
+        (*chars)++;
+    }
+    return words;
+}
+
+static int split_result_ok(const char *s, char c, char **tab, size_t words)
+{
+    size_t w = 0;
+
+    while (*s)
+    {
+        size_t len = 0;
+
+        if (*s == c)
+        {
+            s++;
+            continue ;
+        }
+        while (s[len] && s[len] != c)
+            len++;
+        if (w >= words || strncmp(tab[w], s, len) != 0 || tab[w][len] != '\0')
+            return 0;
+        w++;
+        s += len;
+    }
+    return w == words;
+}
+
+static long peak_rss_kb(void)
+{
+    struct rusage ru;
+
+    getrusage(RUSAGE_SELF, &ru);
+    return ru.ru_maxrss;
+}
+
+/* The input: generated, or the first n bytes of a corpus file (fewer if
+ * the file is shorter), copied out of the mapping to end them with a NUL.
+ * ok stays -1 when that file does not exist. */
+static char *split_input(t_split_job *job)
+{
+    const char  *file = g_splits[job->kind].file;
+    t_corpus    corpus;
+    char        *s;
+
+    if (!file)
+        return make_split_input(job->kind, job->n);
+    job->ok = -1;
+    if (!bench_corpus_open(&corpus, file))
+        return NULL;
+    job->ok = 0;
+    if (job->n > corpus.len)
+        job->n = corpus.len;
+    s = bench_work_copy(corpus.data, job->n);
+    bench_corpus_close(&corpus);
+    return s;
+}
+
+static void split_job(void *ctx)
+{
+    t_split_job *job = ctx;
+    char        *s = split_input(job);
+    char        c = g_splits[job->kind].c;
+    char        **tab;
+    char        tag[64];
+    size_t      chars;
+    long        rss0;
+    uint64_t    t0;
+
+    if (!s)
+        return ;
+    job->expect = split_count(s, c, &chars);
+    job->least = (job->expect + 1) * sizeof(char *) + chars + job->expect;
+    alarm(SPLIT_TIME_LIMIT);
+    rss0 = peak_rss_kb();
+    snprintf(tag, sizeof(tag), "split.%s", g_splits[job->kind].key);
+    prof_begin(tag);
+    alloc_stats_reset();
+    t0 = bench_now_ns();
+    tab = ft_split(s, c);
+    job->ms = (bench_now_ns() - t0) / 1e6;
+    alloc_stats_get(&job->st);
+    prof_end();
+    job->rss_kb = peak_rss_kb() - rss0;
+    if (!tab)
+        return ;
+    while (tab[job->words])
+        job->words++;
+    job->ok = split_result_ok(s, c, tab, job->words);
+    for (size_t i = 0; tab[i]; i++)
+        free(tab[i]);
+    free(tab);
+    if (g_splits[job->kind].file)
+        bench_work_free(s, job->n);
+    else
+        free(s);
+}
+
+static void bench_split(size_t n)
+{
+    char    msg[160];
+    char    sz[32];
+
+    snprintf(msg, sizeof(msg), "ft_split: adversarial inputs (%s)",
+             bench_fmt_bytes(sz, sizeof(sz), n));
+    bench_section(msg);
+    printf("%s%-17s │ %10s %9s %8s │ %10s %10s │ %12s%s\n", CLR_BOLD, "input",
+           "words", "ms", "ns/byte", "mallocs", "bytes/in", "RSS/in", CLR_RESET);
+    for (int kind = 0; kind < SPLIT_COUNT; kind++)
+    {
+        t_split_job job = {kind, n, 0, 0, 0, 0, 0, {0, 0, 0, 0}, 0};
+        int         sig = run_isolated(split_job, &job, sizeof(job), 0, NULL);
+        const char  *name = g_splits[kind].name;
+
+        if (sig == SIGALRM)
+        {
+            printf("%-17s │ %s> %d s, superlinear (strlen of the rest of s per "
+                   "word?)%s\n", name, CLR_RED, SPLIT_TIME_LIMIT, CLR_RESET);
+            snprintf(msg, sizeof(msg), "ft_split: %s: no result within %d s",
+                     name, SPLIT_TIME_LIMIT);
+            result_ko(msg);
+            continue ;
+        }
+        if (sig != 0)
+        {
+            printf("%-17s │ %s%s%s\n", name, CLR_RED, sig > 0 ? strsignal(sig)
+                   : "could not run", CLR_RESET);
+            snprintf(msg, sizeof(msg), "ft_split: %s", name);
+            result_ko(msg);
+            continue ;
+        }
+        if (job.ok < 0)
+        {
+            printf("%-17s │ %sno corpus (`make corpus`)%s\n", name, CLR_YELLOW,
+                   CLR_RESET);
+            continue ;
+        }
+        printf("%-17s │ %10zu %9.1f %8.2f │ %10lu %10.2f │ %12.2f\n", name,
+               job.words, job.ms, job.ms * 1e6 / job.n, job.st.mallocs,
+               (double)job.st.bytes / job.n, job.rss_kb * 1024.0 / job.n);
+        snprintf(msg, sizeof(msg), "split.%s", g_splits[kind].key);
+        metric(msg, job.ms * 1e6 / job.n, "ns/byte");
+        if (!job.ok)
+            snprintf(msg, sizeof(msg), "ft_split: %s: %zu words, expected %zu",
+                     name, job.words, job.expect);
+        else if (job.st.bytes > 2 * job.least)
+            snprintf(msg, sizeof(msg), "ft_split: %s: requested %lu bytes, over "
+                     "2x the %.0f needed", name, job.st.bytes, job.least);
+        else
+        {
+            snprintf(msg, sizeof(msg), "ft_split: %s: %zu words, %.2fx input "
+                     "in allocations", name, job.words, (double)job.st.bytes / job.n);
+            result_ok(msg);
+            if (job.st.mallocs != job.expect + 1)
+                bench_warn("expected exactly one malloc per word plus one for "
+                           "the array");
+            continue ;
+        }
+        result_ko(msg);
+    }
+}
+
+/* ========== Memory and string functions: hot vs cold cache ========== */
+
+/* The same call timed three ways for every size from 16 bytes to
+ * --cache-bytes. hot: the buffers stay in L1, as in a tight test loop.
+ * cold: their lines are flushed (clflush, or dc civac on AArch64) before
+ * every call, so the data comes from DRAM but the TLB still maps it.
+ * tlb: every call gets buffers on pages picked at random from a
+ * --tlb-bytes arena of 4 KiB pages, so the page walk comes on top. With
+ * --evict sweep, or on other CPUs, a pass over a buffer twice the size of
+ * the last-level cache replaces the flushes. */
+#define CACHE_MIN_BYTES     16ul
+#define CACHE_STEP          4
+#define DEFAULT_CACHE_BYTES (64ul << 10)
+#define DEFAULT_TLB_BYTES   (64ul << 20)
+#define COLD_CALLS          1001
+#define SWEEP_CALLS         51
+#define CACHE_LINE          64
+#define CACHE_TARGET        0x01
+
+enum { MODE_HOT, MODE_COLD, MODE_TLB, MODE_COUNT };
+
+static const char   *g_mode_names[MODE_COUNT] = {"hot", "cold", "tlb"};
+
+enum { MEM_MEMSET, MEM_BZERO, MEM_MEMCPY, MEM_MEMMOVE, MEM_MEMCHR, MEM_MEMCMP,
+       MEM_STRLEN, MEM_STRNCMP, MEM_STRLCPY, MEM_COUNT };
+
+static const struct
+{
+    const char  *name;
+    const char  *key;
+    int         two;
+}   g_mems[MEM_COUNT] = {
+    {"ft_memset", "memset", 0},
+    {"ft_bzero", "bzero", 0},
+    {"ft_memcpy", "memcpy", 1},
+    {"ft_memmove", "memmove", 1},
+    {"ft_memchr", "memchr", 0},
+    {"ft_memcmp", "memcmp", 1},
+    {"ft_strlen", "strlen", 0},
+    {"ft_strncmp", "strncmp", 1},
+    {"ft_strlcpy", "strlcpy", 1},
+};
+
+typedef struct s_mem_ctx
+{
+    int             fn;
+    char            *dst;
+    char            *src;
+    size_t          n;
+    volatile size_t res;
+    int             sweep;
+    char            *dummy;
+    size_t          dummy_len;
+}   t_mem_ctx;
+
+/* Every buffer holds n bytes of 'a' and a NUL: strlen and strlcpy
+ * return n, memcmp and strncmp find no difference, memchr no target */
+static void mem_run(void *arg)
+{
+    t_mem_ctx   *ctx = arg;
+
+    if (ctx->fn == MEM_MEMSET)
+        ctx->res = ft_memset(ctx->dst, 'a', ctx->n) == ctx->dst ? ctx->n : 0;
+    else if (ctx->fn == MEM_BZERO)
+    {
+        ft_bzero(ctx->dst, ctx->n);
+        ctx->res = ctx->n;
+    }
+    else if (ctx->fn == MEM_MEMCPY)
+        ctx->res = ft_memcpy(ctx->dst, ctx->src, ctx->n) == ctx->dst ? ctx->n : 0;
+    else if (ctx->fn == MEM_MEMMOVE)
+        ctx->res = ft_memmove(ctx->dst, ctx->src, ctx->n) == ctx->dst ? ctx->n : 0;
+    else if (ctx->fn == MEM_MEMCHR)
+        ctx->res = ft_memchr(ctx->src, CACHE_TARGET, ctx->n) ? 0 : ctx->n;
+    else if (ctx->fn == MEM_MEMCMP)
+        ctx->res = ft_memcmp(ctx->dst, ctx->src, ctx->n) ? 0 : ctx->n;
+    else if (ctx->fn == MEM_STRLEN)
+        ctx->res = ft_strlen(ctx->src);
+    else if (ctx->fn == MEM_STRNCMP)
+        ctx->res = ft_strncmp(ctx->dst, ctx->src, ctx->n + 1) ? 0 : ctx->n;
+    else
+        ctx->res = ft_strlcpy(ctx->dst, ctx->src, ctx->n + 1);
+}
+
+static void mem_fill(char *buf, size_t n)
+{
+    memset(buf, 'a', n);
+    buf[n] = '\0';
+}
+
+static void flush_lines(const void *p, size_t n)
+{
+    const char *end = (const char *)p + n;
+
+    for (const char *c = (const char *)((uintptr_t)p & ~(uintptr_t)(CACHE_LINE - 1));
+         c < end; c += CACHE_LINE)
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_clflush(c);
+#elif defined(__aarch64__)
+        __asm__ volatile ("dc civac, %0" : : "r"(c) : "memory");
+#endif
+    }
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_mfence();
+#elif defined(__aarch64__)
+    __asm__ volatile ("dsb ish" : : : "memory");
+#endif
+}
+
+static int can_flush(void)
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+/* Reads the dummy buffer end to end; what was cached before is gone */
+static void sweep_cache(t_mem_ctx *ctx)
+{
+    volatile char   sink = 0;
+
+    for (size_t i = 0; i < ctx->dummy_len; i += CACHE_LINE)
+        sink += ctx->dummy[i];
+    (void)sink;
+}
+
+static void evict(t_mem_ctx *ctx)
+{
+    if (ctx->sweep)
+        sweep_cache(ctx);
+    else
+    {
+        flush_lines(ctx->src, ctx->n + 1);
+        flush_lines(ctx->dst, ctx->n + 1);
+    }
+}
+
+static int by_ns(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+
+    return (x > y) - (x < y);
+}
+
+/* What bench_now_ns() itself costs, to take off single-call timings */
+static double clock_overhead(void)
+{
+    double  ns[COLD_CALLS];
+
+    for (int i = 0; i < COLD_CALLS; i++)
+    {
+        uint64_t t0 = bench_now_ns();
+
+        ns[i] = (double)(bench_now_ns() - t0);
+    }
+    qsort(ns, COLD_CALLS, sizeof(*ns), by_ns);
+    return ns[COLD_CALLS / 2];
+}
+
+typedef struct s_tlb_arena
+{
+    char    *base;
+    size_t  len;
+    size_t  page;
+    size_t  stride;
+    size_t  slots;
+}   t_tlb_arena;
+
+/* Slots of n + 1 bytes, each at the start of its own run of pages */
+static void tlb_layout(t_tlb_arena *arena, t_mem_ctx *ctx)
+{
+    arena->stride = (ctx->n + 1 + arena->page - 1) / arena->page * arena->page;
+    arena->slots = arena->len / arena->stride;
+    for (size_t i = 0; i < arena->slots; i++)
+        mem_fill(arena->base + i * arena->stride, ctx->n);
+    if (ctx->sweep)
+        sweep_cache(ctx);
+    else
+        for (size_t i = 0; i < arena->slots; i++)
+            flush_lines(arena->base + i * arena->stride, ctx->n + 1);
+}
+
+/* Median of single calls, each after the buffers were evicted (cold) or
+ * moved to random pages (tlb); -1 when a call gave a wrong result */
+static double time_cold(t_mem_ctx *ctx, int mode, t_tlb_arena *arena,
+                        double overhead)
+{
+    int         calls = ctx->sweep ? SWEEP_CALLS : COLD_CALLS;
+    double      ns[COLD_CALLS];
+    uint64_t    seed = 0x9E3779B97F4A7C15ull;
+    char        *dst = ctx->dst;
+    char        *src = ctx->src;
+    int         ok = 1;
+
+    if (mode == MODE_TLB)
+        tlb_layout(arena, ctx);
+    else
+    {
+        mem_fill(ctx->dst, ctx->n);
+        mem_fill(ctx->src, ctx->n);
+    }
+    for (int i = 0; i < calls; i++)
+    {
+        uint64_t t0;
+
+        if (mode == MODE_TLB)
+        {
+            size_t a = bench_rand64(&seed) % arena->slots;
+            size_t b = bench_rand64(&seed) % (arena->slots - 1);
+
+            ctx->dst = arena->base + a * arena->stride;
+            ctx->src = arena->base + (b + (b >= a)) * arena->stride;
+        }
+        else
+            evict(ctx);
+        t0 = bench_now_ns();
+        mem_run(ctx);
+        ns[i] = (double)(bench_now_ns() - t0) - overhead;
+        ok &= ctx->res == ctx->n;
+    }
+    ctx->dst = dst;
+    ctx->src = src;
+    qsort(ns, calls, sizeof(*ns), by_ns);
+    return ok ? (ns[calls / 2] > 0 ? ns[calls / 2] : 0) : -1;
+}
+
+static void print_mem_cell(const double *ns, int mode, int modes)
+{
+    if (!(modes & (1 << mode)))
+        printf(mode == MODE_HOT ? " %9s" : " %9s %6s", "-", "");
+    else if (mode == MODE_HOT)
+        printf(" %9.1f", ns[mode]);
+    else if (!(modes & (1 << MODE_HOT)) || ns[MODE_HOT] <= 0)
+        printf(" %9.1f %6s", ns[mode], "");
+    else
+        printf(" %9.1f %5.1fx", ns[mode], ns[mode] / ns[MODE_HOT]);
+}
+
+static void bench_mem_one(t_mem_ctx *ctx, size_t max_bytes, int reps,
+                          int modes, t_tlb_arena *arena, double overhead)
+{
+    const char  *name = g_mems[ctx->fn].name;
+    double      first[MODE_COUNT] = {0};
+    size_t      first_n = 0;
+    char        msg[160];
+    char        sz[32];
+
+    printf("\n%s\n%s%9s │ %9s %9s %6s %9s %6s │ %8s %8s %8s%s\n", name, CLR_BOLD,
+           "size", "hot ns", "cold ns", "", "tlb ns", "", "hot GB/s", "cold", "tlb",
+           CLR_RESET);
+    for (size_t n = CACHE_MIN_BYTES; n <= max_bytes; n *= CACHE_STEP)
+    {
+        double  ns[MODE_COUNT] = {0};
+
+        ctx->n = n;
+        for (int m = 0; m < MODE_COUNT; m++)
+        {
+            if (!(modes & (1 << m)))
+                continue ;
+            if (m == MODE_HOT)
+            {
+                mem_fill(ctx->dst, n);
+                mem_fill(ctx->src, n);
+                snprintf(msg, sizeof(msg), "cache.%s.%zu.hot", g_mems[ctx->fn].key, n);
+                ns[m] = time_calls(mem_run, ctx, reps, msg);
+                if (ctx->res != n)
+                    ns[m] = -1;
+            }
+            else
+                ns[m] = m == MODE_TLB && !arena->base ? 0
+                        : time_cold(ctx, m, arena, overhead);
+            if (ns[m] < 0)
+            {
+                snprintf(msg, sizeof(msg), "%s: wrong result on %zu bytes (%s)",
+                         name, n, g_mode_names[m]);
+                result_ko(msg);
+                return ;
+            }
+            snprintf(msg, sizeof(msg), "cache.%s.%zu.%s", g_mems[ctx->fn].key, n,
+                     g_mode_names[m]);
+            metric(msg, ns[m], "ns");
+        }
+        printf("%9s │", bench_fmt_bytes(sz, sizeof(sz), n));
+        for (int m = 0; m < MODE_COUNT; m++)
+            print_mem_cell(ns, m, modes);
+        printf(" │");
+        for (int m = 0; m < MODE_COUNT; m++)
+        {
+            if (ns[m] > 0)
+                printf(" %8.2f", n / ns[m]);
+            else
+                printf(" %8s", "-");
+        }
+        printf("\n");
+        if (!first_n)
+        {
+            first_n = n;
+            memcpy(first, ns, sizeof(first));
+        }
+    }
+    if ((modes & (1 << MODE_HOT)) && (modes & (1 << MODE_COLD)) && first[MODE_HOT] > 0)
+        snprintf(msg, sizeof(msg), "%s: %s cold costs %.1fx hot (%.0f vs %.1f ns)",
+                 name, bench_fmt_bytes(sz, sizeof(sz), first_n),
+                 first[MODE_COLD] / first[MODE_HOT], first[MODE_COLD],
+                 first[MODE_HOT]);
+    else
+        snprintf(msg, sizeof(msg), "%s: right results in every mode", name);
+    result_ok(msg);
+}
+
+/* "hot,cold,tlb" (any subset) or "all" */
+static int parse_modes(const char *s)
+{
+    int modes = 0;
+
+    if (strcmp(s, "all") == 0)
+        return (1 << MODE_COUNT) - 1;
+    for (int m = 0; m < MODE_COUNT; m++)
+        if (strstr(s, g_mode_names[m]))
+            modes |= 1 << m;
+    return modes;
+}
+
+static size_t llc_bytes(void)
+{
+    long size = -1;
+
+#ifdef _SC_LEVEL3_CACHE_SIZE
+    size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+    return size > 0 ? (size_t)size : 32ul << 20;
+}
+
+/* len bytes of 4 KiB pages, NULL when they cannot be mapped */
+static char *map_arena(size_t len)
+{
+    char *base = mmap(NULL, len, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (base == MAP_FAILED)
+        return NULL;
+#ifdef MADV_NOHUGEPAGE
+    /* huge pages would cover the whole arena with a few TLB entries */
+    madvise(base, len, MADV_NOHUGEPAGE);
+#endif
+    return base;
+}
+
+static void bench_mem(size_t max_bytes, size_t tlb_bytes, int modes, int sweep,
+                      int reps)
+{
+    t_mem_ctx   ctx = {0, NULL, NULL, 0, 0, sweep || !can_flush(), NULL, 0};
+    t_tlb_arena arena = {NULL, tlb_bytes, (size_t)sysconf(_SC_PAGESIZE), 0, 0};
+    char        sz[2][32];
+
+    bench_section("memory and string functions: hot vs cold cache");
+    ctx.dst = aligned_alloc(CACHE_LINE, (max_bytes + CACHE_LINE) & ~(CACHE_LINE - 1ul));
+    ctx.src = aligned_alloc(CACHE_LINE, (max_bytes + CACHE_LINE) & ~(CACHE_LINE - 1ul));
+    if (ctx.sweep)
+    {
+        ctx.dummy_len = 2 * llc_bytes();
+        ctx.dummy = malloc(ctx.dummy_len);
+        if (ctx.dummy)
+            memset(ctx.dummy, 1, ctx.dummy_len);
+    }
+    if ((modes & (1 << MODE_TLB)) && arena.len >= 2 * (max_bytes + 1 + arena.page))
+        arena.base = map_arena(arena.len);
+    if (!ctx.dst || !ctx.src || (ctx.sweep && !ctx.dummy))
+    {
+        bench_warn("out of memory, skipped");
+        max_bytes = 0;
+    }
+    else if ((modes & (1 << MODE_TLB)) && !arena.base)
+        bench_warn("no room for the TLB arena (--tlb-bytes), tlb column skipped");
+    printf("eviction: %s; tlb: random %s pages of a %s arena\n", ctx.sweep
+           ? "a pass over 2x the last-level cache before every call"
+           : "the buffers' cache lines flushed before every call",
+           bench_fmt_bytes(sz[0], 32, arena.page), bench_fmt_bytes(sz[1], 32, arena.len));
+    for (int fn = 0; fn < MEM_COUNT && max_bytes; fn++)
+    {
+        ctx.fn = fn;
+        bench_mem_one(&ctx, max_bytes, reps, modes, &arena, clock_overhead());
+    }
+    if (arena.base)
+        munmap(arena.base, arena.len);
+    free(ctx.dst);
+    free(ctx.src);
+    free(ctx.dummy);
+}
+
+/* ========== ft_memcmp / ft_strncmp / ft_memchr: early exit ========== */
+
+/* Two equal buffers of n bytes, then the first difference (the byte at p
+ * gets its high bit flipped, so signed-char comparisons give the wrong
+ * sign) or the byte memchr looks for is placed at p = 0, 1, 4, 16, ...
+ * and finally nowhere. The time must follow p, not n: a difference at
+ * byte 0 costs as little in 64 MiB as in 64 bytes, and ns per byte stays
+ * flat up to the full scan. memcmp runs on random.bin, the others on
+ * words.txt (no NUL or 0x01 in it) when the corpus exists. The cold and
+ * tlb columns of --cache time the same positions as single calls, as the
+ * cache table does, on the bytes each call reads. */
+enum { CMP_MEMCMP, CMP_STRNCMP, CMP_MEMCHR, CMP_COUNT };
+
+static const struct
+{
+    const char  *name;
+    const char  *key;
+    const char  *file;
+}   g_cmps[CMP_COUNT] = {
+    {"ft_memcmp", "memcmp", "random.bin"},
+    {"ft_strncmp", "strncmp", "words.txt"},
+    {"ft_memchr", "memchr", "words.txt"},
+};
+
+#define CMP_TARGET  0x01
+
+typedef struct s_cmp_ctx
+{
+    int         fn;
+    const char  *a;
+    const char  *b;
+    char        *work;
+    size_t      n;
+    int         res;
+    const void  *found;
+}   t_cmp_ctx;
+
+static void cmp_run(void *arg)
+{
+    t_cmp_ctx *ctx = arg;
+
+    if (ctx->fn == CMP_MEMCMP)
+        ctx->res = ft_memcmp(ctx->a, ctx->b, ctx->n);
+    else if (ctx->fn == CMP_STRNCMP)
+        ctx->res = ft_strncmp(ctx->a, ctx->b, ctx->n);
+    else
+        ctx->found = ft_memchr(ctx->a, CMP_TARGET, ctx->n);
+}
+
+/* a and b: the same n bytes. The one that gets the difference or the
+ * target is a private copy (work); the other is the corpus mapping itself
+ * when the file is large enough, generated text otherwise. No NUL is
+ * needed: every call is bounded by n. Returns 1 when mapped. */
+static int cmp_buffers(int fn, size_t n, t_cmp_ctx *ctx, t_corpus *corpus)
+{
+    const char *src = NULL;
+
+    if (bench_corpus_open(corpus, g_cmps[fn].file) && n <= corpus->len)
+        src = corpus->data;
+    else
+    {
+        bench_corpus_close(corpus);
+        src = make_text(n);
+    }
+    ctx->work = src ? bench_work_copy(src, n) : NULL;
+    ctx->a = fn == CMP_MEMCHR ? ctx->work : src;
+    ctx->b = fn == CMP_MEMCHR ? src : ctx->work;
+    return corpus->data != NULL;
+}
+
+/* Places the difference (or the target) at p; p == n undoes it */
+static void cmp_mark(t_cmp_ctx *ctx, size_t p, char *saved)
+{
+    if (p == ctx->n)
+        return ;
+    *saved = ctx->work[p];
+    ctx->work[p] = ctx->fn == CMP_MEMCHR ? CMP_TARGET : ctx->work[p] ^ 0x80;
+}
+
+static void cmp_unmark(t_cmp_ctx *ctx, size_t p, char saved)
+{
+    if (p < ctx->n)
+        ctx->work[p] = saved;
+}
+
+static int cmp_result_ok(const t_cmp_ctx *ctx, size_t p)
+{
+    int expect;
+
+    if (ctx->fn == CMP_MEMCHR)
+        return ctx->found == (p < ctx->n ? ctx->a + p : NULL);
+    if (p == ctx->n)
+        return ctx->res == 0;
+    expect = (unsigned char)ctx->a[p] - (unsigned char)(ctx->a[p] ^ 0x80);
+    return (ctx->res < 0) == (expect < 0) && ctx->res != 0;
+}
+
+static void print_cmp_chart(size_t n, const size_t *pos, const double *ns,
+                            const double (*cells)[MODE_COUNT], int count, int modes)
+{
+    double  lo = ns[0];
+    double  hi = ns[0];
+    char    sz[32];
+
+    for (int i = 1; i < count; i++)
+    {
+        lo = ns[i] < lo ? ns[i] : lo;
+        hi = ns[i] > hi ? ns[i] : hi;
+    }
+    for (int i = 0; i < count; i++)
+    {
+        int width = hi > lo ? 1 + (int)((CMP_BAR - 1) * log(ns[i] / lo)
+                                        / log(hi / lo)) : 1;
+
+        printf("%9s │ %12.1f %9.2f │", pos[i] == n ? "none"
+               : bench_fmt_bytes(sz, sizeof(sz), pos[i]), ns[i],
+               (pos[i] == n ? n : pos[i] + 1) / ns[i]);
+        if (modes)
+        {
+            for (int m = MODE_COLD; m < MODE_COUNT; m++)
+            {
+                if (modes & (1 << m))
+                    printf(" %12.1f %5.1fx", cells[i][m], cells[i][m] / ns[i]);
+                else
+                    printf(" %12s %6s", "-", "");
+            }
+            printf(" │");
+        }
+        printf(" ");
+        for (int w = 0; w < width; w++)
+            printf("█");
+        printf("\n");
+    }
+}
+
+/* Early exit: a difference at byte 0 under 1/16 of the full scan. Linear
+ * scan: from 64 KiB to the full buffer ns per byte may grow (caches, then
+ * DRAM) but not 8x. Only judged on buffers of 1 MiB and up. */
+static void cmp_verdict(int fn, size_t n, const size_t *pos, const double *ns,
+                        int count, int wrong)
+{
+    const char  *name = g_cmps[fn].name;
+    char        msg[160];
+    int         mid = 0;
+
+    while (mid + 1 < count && pos[mid] < (64ul << 10))
+        mid++;
+    if (wrong >= 0)
+        snprintf(msg, sizeof(msg), "%s: wrong result with the %s at byte %zu",
+                 name, fn == CMP_MEMCHR ? "target" : "difference", pos[wrong]);
+    else if (n < (1ul << 20))
+    {
+        snprintf(msg, sizeof(msg), "%s: right results at every position", name);
+        result_ok(msg);
+        return ;
+    }
+    else if (ns[0] * 16 > ns[count - 1])
+        snprintf(msg, sizeof(msg), "%s: no early exit, a difference at byte 0 "
+                 "costs %.0f ns of the %.0f ns full scan", name, ns[0],
+                 ns[count - 1]);
+    else if (ns[count - 1] / n > 8 * ns[mid] / (pos[mid] + 1))
+        snprintf(msg, sizeof(msg), "%s: ns/byte grows %.0fx from %zu bytes to "
+                 "the full scan", name, ns[count - 1] / n / (ns[mid] / (pos[mid] + 1)),
+                 pos[mid] + 1);
+    else
+    {
+        snprintf(msg, sizeof(msg), "%s: stops at the first %s, %.2f GB/s over "
+                 "the full scan", name, fn == CMP_MEMCHR ? "match" : "difference",
+                 n / ns[count - 1]);
+        result_ok(msg);
+        return ;
+    }
+    result_ko(msg);
+}
+
+/* cold: the lines a call reads are flushed (or swept) before it. tlb:
+ * then one byte per page of the --tlb-bytes arena is read, so the
+ * buffers' pages have left the TLB too. Calls reading a MiB or more
+ * take milliseconds each and get fewer samples. */
+#define CMP_COLD_CALLS      31
+#define CMP_BIG_CALLS       5
+#define CMP_BIG_BYTES       (1ul << 20)
+
+typedef struct s_cmp_cache
+{
+    int         modes;
+    t_mem_ctx   evict;
+    t_tlb_arena arena;
+    double      overhead;
+}   t_cmp_cache;
+
+static void touch_pages(const t_tlb_arena *arena)
+{
+    volatile char   sink = 0;
+
+    for (size_t i = 0; i < arena->len; i += arena->page)
+        sink += arena->base[i];
+    (void)sink;
+}
+
+/* Median of single calls with the difference at p; -1 on a wrong result */
+static double cmp_time_cold(t_cmp_ctx *ctx, size_t p, int mode,
+                            t_cmp_cache *cache)
+{
+    size_t  len = p < ctx->n ? p + 1 : ctx->n;
+    int     calls = len >= CMP_BIG_BYTES || cache->evict.sweep
+                    ? CMP_BIG_CALLS : CMP_COLD_CALLS;
+    double  ns[CMP_COLD_CALLS];
+    int     ok = 1;
+
+    for (int i = 0; i < calls; i++)
+    {
+        uint64_t t0;
+
+        if (cache->evict.sweep)
+            sweep_cache(&cache->evict);
+        else
+        {
+            flush_lines(ctx->a, len);
+            flush_lines(ctx->b, len);
+        }
+        if (mode == MODE_TLB)
+            touch_pages(&cache->arena);
+        t0 = bench_now_ns();
+        cmp_run(ctx);
+        ns[i] = (double)(bench_now_ns() - t0) - cache->overhead;
+        ok &= cmp_result_ok(ctx, p);
+    }
+    qsort(ns, calls, sizeof(*ns), by_ns);
+    return ok ? (ns[calls / 2] > 0 ? ns[calls / 2] : 0) : -1;
+}
+
+static void bench_cmp_one(int fn, size_t n, int reps, t_cmp_cache *cache)
+{
+    t_cmp_ctx   ctx = {fn, NULL, NULL, NULL, n, 0, NULL};
+    t_corpus    corpus = {NULL, 0};
+    int         mapped = cmp_buffers(fn, n, &ctx, &corpus);
+    const char  *src = fn == CMP_MEMCHR ? ctx.b : ctx.a;
+    size_t      pos[64];
+    double      ns[64];
+    double      cells[64][MODE_COUNT] = {{0}};
+    int         count = 0;
+    int         wrong = -1;
+    char        key[64];
+
+    if (!ctx.a || !ctx.b)
+    {
+        if (!mapped)
+            free((char *)src);
+        bench_corpus_close(&corpus);
+        bench_work_free(ctx.work, n);
+        bench_warn("out of memory, skipped");
+        return ;
+    }
+    for (size_t p = 0; p < n; p = p ? p * 4 : 1)
+        pos[count++] = p;
+    pos[count++] = n;
+    printf("\n%s on %s\n%s%9s │ %12s %9s │", g_cmps[fn].name,
+           mapped ? g_cmps[fn].file : "generated text", CLR_BOLD, "p", "ns",
+           "GB/s");
+    if (cache->modes)
+        printf(" %12s %6s %12s %6s │", "cold ns", "", "tlb ns", "");
+    printf(" ns (log scale)%s\n", CLR_RESET);
+    for (int i = 0; i < count; i++)
+    {
+        char saved = 0;
+
+        if (pos[i] == n)
+            snprintf(key, sizeof(key), "%s.none", g_cmps[fn].key);
+        else
+            snprintf(key, sizeof(key), "%s.at_%zu", g_cmps[fn].key, pos[i]);
+        cmp_mark(&ctx, pos[i], &saved);
+        ns[i] = time_calls(cmp_run, &ctx, reps, key);
+        if (!cmp_result_ok(&ctx, pos[i]) && wrong < 0)
+            wrong = i;
+        metric(key, ns[i], "ns");
+        cells[i][MODE_HOT] = ns[i];
+        for (int m = MODE_COLD; m < MODE_COUNT; m++)
+        {
+            char cell_key[80];
+
+            if (!(cache->modes & (1 << m)))
+                continue ;
+            cells[i][m] = cmp_time_cold(&ctx, pos[i], m, cache);
+            if (cells[i][m] < 0 && wrong < 0)
+                wrong = i;
+            snprintf(cell_key, sizeof(cell_key), "%s.%s", key, g_mode_names[m]);
+            metric(cell_key, cells[i][m], "ns");
+        }
+        cmp_unmark(&ctx, pos[i], saved);
+    }
+    print_cmp_chart(n, pos, ns, (const double (*)[MODE_COUNT])cells, count,
+                    cache->modes);
+    cmp_verdict(fn, n, pos, ns, count, wrong);
+    bench_work_free(ctx.work, n);
+    if (mapped)
+        bench_corpus_close(&corpus);
+    else
+        free((char *)src);
+}
+
+static void bench_cmp(size_t n, int reps, int modes, int sweep,
+                      size_t tlb_bytes)
+{
+    t_cmp_cache cache = {modes & ~(1 << MODE_HOT), {0}, {NULL, tlb_bytes,
+                         (size_t)sysconf(_SC_PAGESIZE), 0, 0}, 0};
+    char        sz[32];
+    char        title[96];
+
+    snprintf(title, sizeof(title), "ft_memcmp / ft_strncmp / ft_memchr: "
+             "first difference at byte p (%s)", bench_fmt_bytes(sz, sizeof(sz), n));
+    bench_section(title);
+    cache.evict.sweep = sweep || !can_flush();
+    if (cache.modes && cache.evict.sweep)
+    {
+        cache.evict.dummy_len = 2 * llc_bytes();
+        cache.evict.dummy = malloc(cache.evict.dummy_len);
+        if (cache.evict.dummy)
+            memset(cache.evict.dummy, 1, cache.evict.dummy_len);
+        else
+            cache.modes = 0;
+    }
+    if (cache.modes & (1 << MODE_TLB))
+    {
+        cache.arena.base = map_arena(cache.arena.len);
+        if (cache.arena.base)
+            memset(cache.arena.base, 1, cache.arena.len);
+        else
+            cache.modes &= ~(1 << MODE_TLB);
+    }
+    if ((modes & ~(1 << MODE_HOT)) && !cache.modes)
+        bench_warn("out of memory, cold and tlb columns skipped");
+    cache.overhead = clock_overhead();
+    for (int fn = 0; fn < CMP_COUNT; fn++)
+        bench_cmp_one(fn, n, reps, &cache);
+    if (cache.arena.base)
+        munmap(cache.arena.base, cache.arena.len);
+    free(cache.evict.dummy);
+}
+
+/* ========== Main Benchmark Runner ========== */
+
+static void usage(const char *prog)
+{
+    printf("usage: %s [--max-bytes N] [--split-bytes N] [--cmp-bytes N] "
+           "[--reps N]\n"
+           "       [--cache-bytes N] [--tlb-bytes N] [--cache hot,cold,tlb|all] "
+           "[--evict flush|sweep]\n"
+           "       [--cpu N] [--priority] [--cv-max P]\n"
+           "       [--profile FILE] [--profile-only LIST] [--profile-hz N]\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+    size_t  max_bytes = DEFAULT_MAX_BYTES;
+    size_t  split_bytes = DEFAULT_SPLIT_BYTES;
+    size_t  cmp_bytes = DEFAULT_CMP_BYTES;
+    size_t  cache_bytes = DEFAULT_CACHE_BYTES;
+    size_t  tlb_bytes = DEFAULT_TLB_BYTES;
+    int     modes = (1 << MODE_COUNT) - 1;
+    int     sweep = 0;
+    int     reps = DEFAULT_REPS;
+
+    setvbuf(stdout, NULL, _IONBF, 0);
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--max-bytes") == 0 && i + 1 < argc)
+            max_bytes = (size_t)bench_parse_count(argv[++i]);
+        else if (strcmp(argv[i], "--split-bytes") == 0 && i + 1 < argc)
+            split_bytes = (size_t)bench_parse_count(argv[++i]);
+        else if (strcmp(argv[i], "--cmp-bytes") == 0 && i + 1 < argc)
+            cmp_bytes = (size_t)bench_parse_count(argv[++i]);
+        else if (strcmp(argv[i], "--reps") == 0 && i + 1 < argc)
+            reps = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--cache-bytes") == 0 && i + 1 < argc)
+            cache_bytes = (size_t)bench_parse_count(argv[++i]);
+        else if (strcmp(argv[i], "--tlb-bytes") == 0 && i + 1 < argc)
+            tlb_bytes = (size_t)bench_parse_count(argv[++i]);
+        else if (strcmp(argv[i], "--cache") == 0 && i + 1 < argc)
+            modes = parse_modes(argv[++i]);
+        else if (strcmp(argv[i], "--evict") == 0 && i + 1 < argc)
+            sweep = strcmp(argv[++i], "sweep") == 0;
+        else if (!bench_env_arg(argc, argv, &i))
+        {
+            usage(argv[0]);
+            return (2);
+        }
+    }
+    if (reps < 1)
+        reps = 1;
+
+    part_header("BENCH: Mandatory String Functions");
+    bench_env_begin();
+    if (modes)
+        bench_mem(cache_bytes, tlb_bytes, modes, sweep, reps);
+    bench_mapi(max_bytes, reps);
+    bench_split(split_bytes);
+    bench_cmp(cmp_bytes, reps, modes, sweep, tlb_bytes);
+
+    bench_env_end();
+    summary();
+    return (tests_run == tests_passed ? 0 : 1);
+}
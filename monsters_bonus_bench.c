@@ -0,0 +1,362 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   monsters_bonus_bench.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include "bench_env.h"
+
+int tests_run = 0;
+int tests_passed = 0;
+
+/* Every size runs on a bounded stack in its own child: a recursive
+ * ft_lstclear/ft_lstmap dies with SIGSEGV instead of passing silently,
+ * and the child's peak RSS is exactly the footprint of that size. */
+#define LIST_STACK       (256 * 1024)
+#define DEFAULT_MAX      10000000
+#define DEFAULT_REPS     3
+#define LAYOUT_SEED      0x1337
+#define LAYOUT_MIN_WORK  1000000
+
+/* ========== Helper Functions ========== */
+
+static void *map_identity(void *content)
+{
+    return content;
+}
+
+static void del_nothing(void *content)
+{
+    (void)content;
+}
+
+static t_list *build_list(long n)
+{
+    t_list *lst = NULL;
+    while (n-- > 0)
+        ft_lstadd_front(&lst, ft_lstnew((void *)(intptr_t)n));
+    return lst;
+}
+
+static int same_contents(t_list *a, t_list *b)
+{
+    while (a && b)
+    {
+        if (a == b || a->content != b->content)
+            return 0;
+        a = a->next;
+        b = b->next;
+    }
+    return a == NULL && b == NULL;
+}
+
+/* ========== ft_lstmap / ft_lstclear ========== */
+
+typedef struct s_map_clear_job
+{
+    long            nodes;
+    int             reps;
+    int             ok;
+    double          map_ns;
+    double          map_mallocs;
+    double          map_frees;
+    double          clear_ns;
+    double          clear_mallocs;
+    double          clear_frees;
+    t_bench_runs    map_runs;
+    t_bench_runs    clear_runs;
+}   t_map_clear_job;
+
+static void map_clear_job(void *ctx)
+{
+    t_map_clear_job *job = ctx;
+    t_list          *lst = build_list(job->nodes);
+    t_alloc_stats   st;
+    double          n = (double)job->nodes;
+    char            tag[64];
+
+    job->ok = ft_lstsize(lst) == job->nodes;
+    job->map_ns = -1;
+    job->clear_ns = -1;
+    snprintf(tag, sizeof(tag), "lstmap/lstclear, %ld nodes", job->nodes);
+    prof_begin(tag);
+    for (int rep = 0; rep < job->reps && job->ok; rep++)
+    {
+        alloc_stats_reset();
+        uint64_t t0 = bench_now_ns();
+        t_list *mapped = ft_lstmap(lst, map_identity, del_nothing);
+        uint64_t t1 = bench_now_ns();
+        alloc_stats_get(&st);
+        job->ok = same_contents(lst, mapped);
+        if (job->map_ns < 0 || (t1 - t0) / n < job->map_ns)
+            job->map_ns = (t1 - t0) / n;
+        bench_runs_add(&job->map_runs, (t1 - t0) / n);
+        job->map_mallocs = st.mallocs / n;
+        job->map_frees = st.frees / n;
+
+        alloc_stats_reset();
+        t0 = bench_now_ns();
+        ft_lstclear(&mapped, del_nothing);
+        t1 = bench_now_ns();
+        alloc_stats_get(&st);
+        job->ok = job->ok && mapped == NULL;
+        if (job->clear_ns < 0 || (t1 - t0) / n < job->clear_ns)
+            job->clear_ns = (t1 - t0) / n;
+        bench_runs_add(&job->clear_runs, (t1 - t0) / n);
+        job->clear_mallocs = st.mallocs / n;
+        job->clear_frees = st.frees / n;
+    }
+    prof_end();
+    ft_lstclear(&lst, del_nothing);
+}
+
+static void bench_map_clear(long max_nodes, int reps)
+{
+    bench_section("ft_lstmap / ft_lstclear (per node)");
+    printf("%s%10s │ %9s %8s %8s │ %9s %8s │ %10s%s\n", CLR_BOLD,
+           "nodes", "map ns", "malloc", "free", "clear ns", "free",
+           "peak RSS", CLR_RESET);
+
+    for (long nodes = 1000; nodes <= max_nodes; nodes *= 10)
+    {
+        t_map_clear_job job = {nodes, reps, 0, 0, 0, 0, 0, 0, 0, {0, 0, 0},
+                               {0, 0, 0}};
+        long            rss_kb = 0;
+        char            msg[128];
+        int             sig;
+
+        sig = run_isolated(map_clear_job, &job, sizeof(job), LIST_STACK, &rss_kb);
+        if (sig != 0)
+        {
+            printf("%10ld │ %s%s%s\n", nodes, CLR_RED,
+                   sig == SIGSEGV ? "stack overflow (recursive ft_lstclear/ft_lstmap?)"
+                                  : "crashed", CLR_RESET);
+            snprintf(msg, sizeof(msg), "ft_lstmap/ft_lstclear: %ld nodes on a "
+                     "256 KiB stack", nodes);
+            result_ko(msg);
+            return;
+        }
+        printf("%10ld │ %9.2f %8.2f %8.2f │ %9.2f %8.2f │ %7.1f MiB\n",
+               nodes, job.map_ns, job.map_mallocs, job.map_frees,
+               job.clear_ns, job.clear_frees, rss_kb / 1024.0);
+        metric("lstmap", job.map_ns, "ns/node");
+        metric("lstclear", job.clear_ns, "ns/node");
+        metric("lstmap.mallocs", job.map_mallocs, "per node");
+        snprintf(msg, sizeof(msg), "lstmap, %ld nodes", nodes);
+        bench_check_cv(msg, &job.map_runs);
+        snprintf(msg, sizeof(msg), "lstclear, %ld nodes", nodes);
+        bench_check_cv(msg, &job.clear_runs);
+        if (!job.ok)
+        {
+            snprintf(msg, sizeof(msg), "ft_lstmap/ft_lstclear: wrong result on "
+                     "%ld nodes", nodes);
+            result_ko(msg);
+            return;
+        }
+        if (job.map_mallocs != 1 || job.map_frees != 0
+            || job.clear_mallocs != 0 || job.clear_frees != 1)
+            bench_warn("expected exactly 1 malloc per mapped node and "
+                       "1 free per cleared node");
+    }
+    result_ok("ft_lstmap/ft_lstclear: long lists on a 256 KiB stack");
+}
+
+/* ========== Node Layout: contiguous vs scattered ========== */
+
+/* Both layouts use the same arena of nodes; only the link order differs.
+ * Contiguous lists walk the arena front to back, scattered lists follow a
+ * random permutation of its slots, like a heap fragmented by hours of
+ * allocations and frees. */
+enum { OP_SIZE, OP_ITER, OP_LAST, OP_COUNT };
+
+static const char *op_names[OP_COUNT] = {"lstsize", "lstiter", "lstlast"};
+
+typedef struct s_layout_job
+{
+    long            nodes;
+    int             reps;
+    int             scattered;
+    int             ok;
+    double          ns[OP_COUNT];
+    t_bench_runs    runs[OP_COUNT];
+}   t_layout_job;
+
+static intptr_t g_iter_sum;
+
+static void iter_sum(void *content)
+{
+    g_iter_sum += (intptr_t)content;
+}
+
+static t_list *link_arena(t_list *arena, long n, int scattered)
+{
+    long        *order = malloc(n * sizeof(*order));
+    uint64_t    seed = LAYOUT_SEED;
+
+    if (!order)
+        return NULL;
+    for (long i = 0; i < n; i++)
+        order[i] = i;
+    for (long i = n - 1; scattered && i > 0; i--)
+    {
+        long j = bench_rand64(&seed) % (i + 1);
+        long tmp = order[i];
+        order[i] = order[j];
+        order[j] = tmp;
+    }
+    for (long i = 0; i < n; i++)
+    {
+        arena[order[i]].content = (void *)(intptr_t)1;
+        arena[order[i]].next = i + 1 < n ? &arena[order[i + 1]] : NULL;
+    }
+    t_list *head = &arena[order[0]];
+    t_list *tail = &arena[order[n - 1]];
+    free(order);
+    tail->content = (void *)(intptr_t)2;
+    return head;
+}
+
+static void layout_job(void *ctx)
+{
+    t_layout_job    *job = ctx;
+    t_list          *arena = malloc(job->nodes * sizeof(t_list));
+    t_list          *lst;
+    long            passes = LAYOUT_MIN_WORK / job->nodes;
+    double          work;
+    char            tag[64];
+
+    job->ok = 0;
+    if (!arena || !(lst = link_arena(arena, job->nodes, job->scattered)))
+        return ;
+    if (passes < 1)
+        passes = 1;
+    work = (double)passes * job->nodes;
+    job->ok = 1;
+    for (int op = 0; op < OP_COUNT; op++)
+        job->ns[op] = -1;
+    snprintf(tag, sizeof(tag), "lstsize/lstiter/lstlast %s, %ld nodes",
+             job->scattered ? "scattered" : "contiguous", job->nodes);
+    prof_begin(tag);
+    for (int rep = 0; rep < job->reps; rep++)
+    {
+        for (int op = 0; op < OP_COUNT; op++)
+        {
+            uint64_t t0 = bench_now_ns();
+            for (long p = 0; p < passes; p++)
+            {
+                if (op == OP_SIZE)
+                    job->ok &= ft_lstsize(lst) == job->nodes;
+                else if (op == OP_ITER)
+                {
+                    g_iter_sum = 0;
+                    ft_lstiter(lst, iter_sum);
+                    job->ok &= g_iter_sum == job->nodes + 1;
+                }
+                else
+                    job->ok &= ft_lstlast(lst)->content == (void *)(intptr_t)2;
+            }
+            double ns = (bench_now_ns() - t0) / work;
+            if (job->ns[op] < 0 || ns < job->ns[op])
+                job->ns[op] = ns;
+            bench_runs_add(&job->runs[op], ns);
+        }
+    }
+    prof_end();
+    free(arena);
+}
+
+static void bench_layout(long max_nodes, int reps)
+{
+    bench_section("ft_lstsize / ft_lstiter / ft_lstlast: contiguous vs scattered (ns/node)");
+    printf("%s%10s │ %17s %6s │ %17s %6s │ %17s %6s%s\n", CLR_BOLD, "nodes",
+           "lstsize cont/scat", "x", "lstiter cont/scat", "x",
+           "lstlast cont/scat", "x", CLR_RESET);
+
+    for (long nodes = 1000; nodes <= max_nodes; nodes *= 10)
+    {
+        t_layout_job    job[2];
+        char            msg[128];
+        int             sig = 0;
+
+        for (int scattered = 0; scattered < 2 && sig == 0; scattered++)
+        {
+            job[scattered] = (t_layout_job){nodes, reps, scattered, 0, {0}, {{0, 0, 0}}};
+            sig = run_isolated(layout_job, &job[scattered], sizeof(*job),
+                               LIST_STACK, NULL);
+        }
+        if (sig != 0 || !job[0].ok || !job[1].ok)
+        {
+            printf("%10ld │ %s%s%s\n", nodes, CLR_RED, sig == SIGSEGV
+                   ? "stack overflow (recursive list walk?)" : "wrong result",
+                   CLR_RESET);
+            snprintf(msg, sizeof(msg), "ft_lstsize/ft_lstiter/ft_lstlast: "
+                     "%ld nodes in both layouts", nodes);
+            result_ko(msg);
+            return;
+        }
+        printf("%10ld", nodes);
+        for (int op = 0; op < OP_COUNT; op++)
+        {
+            char key[64];
+
+            printf(" │ %8.2f %8.2f %5.1fx", job[0].ns[op], job[1].ns[op],
+                   job[1].ns[op] / job[0].ns[op]);
+            snprintf(key, sizeof(key), "%s.contiguous", op_names[op]);
+            metric(key, job[0].ns[op], "ns/node");
+            snprintf(key, sizeof(key), "%s.scattered", op_names[op]);
+            metric(key, job[1].ns[op], "ns/node");
+            snprintf(key, sizeof(key), "%s contiguous, %ld nodes", op_names[op], nodes);
+            bench_check_cv(key, &job[0].runs[op]);
+            snprintf(key, sizeof(key), "%s scattered, %ld nodes", op_names[op], nodes);
+            bench_check_cv(key, &job[1].runs[op]);
+        }
+        printf("\n");
+    }
+    result_ok("ft_lstsize/ft_lstiter/ft_lstlast: contiguous and scattered layouts");
+}
+
+/* ========== Main Benchmark Runner ========== */
+
+static void usage(const char *prog)
+{
+    printf("usage: %s [--max-nodes N] [--reps N] [--cpu N] [--priority] "
+           "[--cv-max P]\n"
+           "       [--profile FILE] [--profile-only LIST] [--profile-hz N]\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+    long    max_nodes = DEFAULT_MAX;
+    int     reps = DEFAULT_REPS;
+
+    setvbuf(stdout, NULL, _IONBF, 0);
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--max-nodes") == 0 && i + 1 < argc)
+            max_nodes = (long)bench_parse_count(argv[++i]);
+        else if (strcmp(argv[i], "--reps") == 0 && i + 1 < argc)
+            reps = atoi(argv[++i]);
+        else if (!bench_env_arg(argc, argv, &i))
+        {
+            usage(argv[0]);
+            return (2);
+        }
+    }
+    if (reps < 1)
+        reps = 1;
+
+    part_header("BENCH: Bonus Linked List Functions");
+    bench_env_begin();
+    bench_map_clear(max_nodes, reps);
+    bench_layout(max_nodes, reps);
+
+    bench_env_end();
+    summary();
+    return (tests_run == tests_passed ? 0 : 1);
+}
@@ -72,6 +72,25 @@ static void *map_dup(void *content)
     return strdup(str);
 }
 
+static void *map_identity(void *content)
+{
+    return content;
+}
+
+static void del_nothing(void *content)
+{
+    (void)content;
+}
+
+/* Builds a list of n nodes whose content is the node index, in O(n). */
+static t_list *build_list(int n)
+{
+    t_list *lst = NULL;
+    while (n-- > 0)
+        ft_lstadd_front(&lst, ft_lstnew((void *)(intptr_t)n));
+    return lst;
+}
+
 /* ========== ft_lstnew Tests ========== */
 
 static void test_lstnew(void)
@@ -497,31 +516,95 @@ static void test_memory_safety(void)
     result_ok("Memory safety: 50 iter cycles");
 }
 
+/* ========== Long List Tests ========== */
+
+/* Recursive teardown or mapping needs one stack frame per node; on a
+ * 256 KiB stack that overflows long before 100000 nodes. */
+#define LONG_LIST_NODES 100000
+#define LONG_LIST_STACK (256 * 1024)
+
+typedef struct s_long_job
+{
+    int nodes;
+    int ok;
+}   t_long_job;
+
+static void long_clear_job(void *ctx)
+{
+    t_long_job *job = ctx;
+    t_list *lst = build_list(job->nodes);
+
+    job->ok = ft_lstsize(lst) == job->nodes;
+    ft_lstclear(&lst, del_nothing);
+    job->ok = job->ok && lst == NULL;
+}
+
+static void long_map_job(void *ctx)
+{
+    t_long_job *job = ctx;
+    t_list *lst = build_list(job->nodes);
+    t_list *mapped = ft_lstmap(lst, map_identity, del_nothing);
+    t_list *a = lst;
+    t_list *b = mapped;
+
+    job->ok = mapped != NULL && mapped != lst;
+    while (job->ok && a && b)
+    {
+        job->ok = b != a && b->content == a->content;
+        a = a->next;
+        b = b->next;
+    }
+    job->ok = job->ok && a == NULL && b == NULL;
+    free_list(mapped);
+    free_list(lst);
+}
+
+static void test_long_lists(void)
+{
+    printf("\n%s=== Long Lists (stack depth) ===%s\n", CLR_YELLOW, CLR_RESET);
+    
+    t_long_job job = {LONG_LIST_NODES, 0};
+    int sig = run_isolated(long_clear_job, &job, sizeof(job), LONG_LIST_STACK, NULL);
+    if (sig == 0 && job.ok)
+        result_ok("ft_lstclear: 100000 nodes on a 256 KiB stack");
+    else if (sig == SIGSEGV)
+        result_ko("ft_lstclear: stack overflow on 100000 nodes (recursive?)");
+    else
+        result_ko("ft_lstclear: 100000 nodes on a 256 KiB stack");
+    
+    job.ok = 0;
+    sig = run_isolated(long_map_job, &job, sizeof(job), LONG_LIST_STACK, NULL);
+    if (sig == 0 && job.ok)
+        result_ok("ft_lstmap: 100000 nodes on a 256 KiB stack");
+    else if (sig == SIGSEGV)
+        result_ko("ft_lstmap: stack overflow on 100000 nodes (recursive?)");
+    else
+        result_ko("ft_lstmap: 100000 nodes on a 256 KiB stack");
+}
+
 /* ========== Main Test Runner ========== */
 
-int main(void)
+static const t_test g_tests[] = {
+    PART("PART 3: Bonus Linked List Functions", test_lstnew),
+    TEST(test_lstadd_front),
+    TEST(test_lstsize),
+    TEST(test_lstlast),
+    TEST(test_lstadd_back),
+    TEST(test_lstdelone),
+    TEST(test_lstclear),
+    TEST(test_lstiter),
+    TEST(test_lstmap),
+    TEST(test_edge_cases),
+    TEST(test_memory_safety),
+    TEST(test_long_lists),
+};
+
+int main(int argc, char **argv)
 {
     setvbuf(stdout, NULL, _IONBF, 0);
     banner();
     
-    printf("\n%s%s╔════════════════════════════════════════════════╗%s\n", 
-           CLR_BOLD, CLR_CYAN, CLR_RESET);
-    printf("%s%s║    PART 3: Bonus Linked List Functions        ║%s\n", 
-           CLR_BOLD, CLR_CYAN, CLR_RESET);
-    printf("%s%s╚════════════════════════════════════════════════╝%s\n", 
-           CLR_BOLD, CLR_CYAN, CLR_RESET);
-    
-    test_lstnew();
-    test_lstadd_front();
-    test_lstsize();
-    test_lstlast();
-    test_lstadd_back();
-    test_lstdelone();
-    test_lstclear();
-    test_lstiter();
-    test_lstmap();
-    test_edge_cases();
-    test_memory_safety();
+    run_tests(g_tests, TEST_COUNT(g_tests), argc, argv);
     
     summary();
     
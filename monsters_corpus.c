@@ -0,0 +1,332 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   monsters_corpus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <errno.h>
+#include "bench_utils.h"
+
+/* Writes the benchmark corpora once, so the benchmarks can mmap them
+ * instead of generating their inputs on every run. Each file is a pure
+ * function of (name, --size, --seed): it is rewritten only when one of
+ * them changed, which MANIFEST records. */
+#define DEFAULT_SIZE    (64ul << 20)
+#define DEFAULT_SEED    0xC0DEull
+#define OUT_BUF         (1ul << 20)
+#define FORMAT          1
+
+/* ========== Output ========== */
+
+typedef struct s_out
+{
+    int     fd;
+    size_t  left;
+    size_t  used;
+    int     failed;
+    char    buf[OUT_BUF];
+}   t_out;
+
+static t_out    g_out;
+
+static void flush_out(t_out *o)
+{
+    size_t done = 0;
+
+    while (done < o->used && !o->failed)
+    {
+        ssize_t n = write(o->fd, o->buf + done, o->used - done);
+
+        if (n < 0 && errno == EINTR)
+            continue ;
+        if (n <= 0)
+            o->failed = 1;
+        else
+            done += n;
+    }
+    o->used = 0;
+}
+
+/* Appends up to n bytes; whatever goes past the file size is dropped */
+static void put(t_out *o, const void *src, size_t n)
+{
+    const char *s = src;
+
+    while (n && o->left)
+    {
+        size_t k = n;
+
+        if (k > o->left)
+            k = o->left;
+        if (k > OUT_BUF - o->used)
+            k = OUT_BUF - o->used;
+        memcpy(o->buf + o->used, s, k);
+        o->used += k;
+        o->left -= k;
+        s += k;
+        n -= k;
+        if (o->used == OUT_BUF)
+            flush_out(o);
+    }
+}
+
+/* ========== Generators ========== */
+
+static void gen_random(t_out *o, uint64_t *rng)
+{
+    while (o->left)
+    {
+        uint64_t x = bench_rand64(rng);
+
+        put(o, &x, sizeof(x));
+    }
+}
+
+/* Mixed-case words, so case-folding callbacks take both branches */
+static void gen_words(t_out *o, uint64_t *rng)
+{
+    static const char   *vocab[] = {
+        "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog",
+        "libft", "monster", "split", "join", "trim", "memory", "string",
+        "pointer", "buffer", "cache", "page", "kernel", "thread", "a", "of",
+        "to", "in", "is", "benchmark", "allocation", "delimiter", "corpus",
+        "x", "hashing",
+    };
+    char                word[32];
+    unsigned long       count = 0;
+
+    while (o->left)
+    {
+        uint64_t    r = bench_rand64(rng);
+        size_t      len = strlen(vocab[r % 32]);
+
+        memcpy(word, vocab[r % 32], len);
+        if ((r >> 8) % 32 == 0)
+            for (size_t i = 0; i < len; i++)
+                word[i] = toupper((unsigned char)word[i]);
+        else if ((r >> 8) % 4 == 0)
+            word[0] = toupper((unsigned char)word[0]);
+        word[len++] = ++count % 12 ? ' ' : '\n';
+        put(o, word, len);
+    }
+}
+
+/* Rows of 8 ints: a quarter small, the rest anywhere in int's range */
+static void gen_csv(t_out *o, uint64_t *rng)
+{
+    char            field[16];
+    unsigned long   count = 0;
+
+    while (o->left)
+    {
+        uint64_t    r = bench_rand64(rng);
+        long        v = r % 4 ? (long)(int32_t)(r >> 32) : (long)((r >> 32) % 1000);
+        int         len = snprintf(field, sizeof(field), "%ld%c", v,
+                                   ++count % 8 ? ',' : '\n');
+
+        put(o, field, len);
+    }
+}
+
+/* Short words between runs of 1 to 4096 commas */
+static void gen_delims(t_out *o, uint64_t *rng)
+{
+    static char commas[4096];
+    char        word[8];
+
+    memset(commas, ',', sizeof(commas));
+    while (o->left)
+    {
+        uint64_t    r = bench_rand64(rng);
+        size_t      len = 1 + r % 8;
+        size_t      run = 1 + (r >> 16) % (1ul << ((r >> 8) % 13));
+
+        for (size_t i = 0; i < len; i++)
+            word[i] = 'a' + (r >> (24 + 4 * i)) % 26;
+        put(o, word, len);
+        put(o, commas, run);
+    }
+}
+
+static const struct
+{
+    const char  *name;
+    void        (*gen)(t_out *, uint64_t *);
+    const char  *what;
+}   g_files[] = {
+    {"random.bin", gen_random, "random bytes"},
+    {"words.txt", gen_words, "ASCII words, mixed case"},
+    {"numbers.csv", gen_csv, "numeric CSV, 8 ints per row"},
+    {"delims.txt", gen_delims, "long runs of ',' between words"},
+};
+
+#define FILE_COUNT (sizeof(g_files) / sizeof(g_files[0]))
+
+/* ========== Files ========== */
+
+static int mkdir_p(const char *dir)
+{
+    char path[PATH_MAX];
+
+    snprintf(path, sizeof(path), "%s", dir);
+    for (char *p = path + 1; *p; p++)
+    {
+        if (*p != '/')
+            continue ;
+        *p = '\0';
+        if (mkdir(path, 0755) < 0 && errno != EEXIST)
+            return -1;
+        *p = '/';
+    }
+    return mkdir(path, 0755) < 0 && errno != EEXIST ? -1 : 0;
+}
+
+static void manifest_line(char *line, size_t size, int f, size_t bytes,
+                          uint64_t seed)
+{
+    snprintf(line, size, "%s\t%zu\t%llu\t%d\n", g_files[f].name, bytes,
+             (unsigned long long)seed, FORMAT);
+}
+
+/* Up to date: same size on disk and the same line in the old MANIFEST */
+static int up_to_date(const char *dir, const char *manifest, int f,
+                      size_t bytes, uint64_t seed)
+{
+    char        path[PATH_MAX];
+    char        line[256];
+    struct stat st;
+
+    manifest_line(line, sizeof(line), f, bytes, seed);
+    snprintf(path, sizeof(path), "%s/%s", dir, g_files[f].name);
+    return manifest && strstr(manifest, line)
+           && stat(path, &st) == 0 && (size_t)st.st_size == bytes + 1;
+}
+
+static char *read_manifest(const char *dir)
+{
+    char    path[PATH_MAX];
+    char    *text = calloc(4096, 1);
+    FILE    *fp;
+
+    snprintf(path, sizeof(path), "%s/MANIFEST", dir);
+    if (!text || !(fp = fopen(path, "r")))
+        return text;
+    if (fread(text, 1, 4095, fp) == 0)
+        text[0] = '\0';
+    fclose(fp);
+    return text;
+}
+
+/* Writes to name.tmp and renames it, so a reader never maps half a file */
+static int write_file(const char *dir, int f, size_t bytes, uint64_t seed)
+{
+    char        path[PATH_MAX];
+    char        tmp[PATH_MAX + 4];
+    uint64_t    rng = seed ^ (0x9E3779B97F4A7C15ull * (f + 1));
+
+    snprintf(path, sizeof(path), "%s/%s", dir, g_files[f].name);
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    if ((g_out.fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644)) < 0)
+        return -1;
+    g_out.left = bytes;
+    g_out.used = 0;
+    g_out.failed = 0;
+    if (!rng)
+        rng = 1;
+    g_files[f].gen(&g_out, &rng);
+    g_out.left = 1;
+    put(&g_out, "", 1);
+    flush_out(&g_out);
+    if (close(g_out.fd) < 0 || g_out.failed || rename(tmp, path) < 0)
+    {
+        unlink(tmp);
+        return -1;
+    }
+    return 0;
+}
+
+/* ========== Main ========== */
+
+static void usage(const char *prog)
+{
+    printf("usage: %s [--out DIR] [--size N] [--seed S] [--force]\n"
+           "  DIR defaults to $MONSTERS_CORPUS or %s; N to 64M per file\n",
+           prog, CORPUS_DEFAULT_DIR);
+}
+
+int main(int argc, char **argv)
+{
+    const char  *dir = bench_corpus_dir();
+    size_t      bytes = DEFAULT_SIZE;
+    uint64_t    seed = DEFAULT_SEED;
+    int         force = 0;
+    char        *manifest;
+    FILE        *fp;
+    char        path[PATH_MAX];
+    char        sz[32];
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--out") == 0 && i + 1 < argc)
+            dir = argv[++i];
+        else if (strcmp(argv[i], "--size") == 0 && i + 1 < argc)
+            bytes = (size_t)bench_parse_count(argv[++i]);
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            seed = strtoull(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "--force") == 0)
+            force = 1;
+        else
+        {
+            usage(argv[0]);
+            return (2);
+        }
+    }
+    if (mkdir_p(dir) < 0)
+    {
+        perror(dir);
+        return (1);
+    }
+    manifest = read_manifest(dir);
+    snprintf(path, sizeof(path), "%s/MANIFEST", dir);
+    unlink(path);
+    for (size_t f = 0; f < FILE_COUNT; f++)
+    {
+        uint64_t t0 = bench_now_ns();
+
+        if (!force && up_to_date(dir, manifest, f, bytes, seed))
+        {
+            printf("  · %-12s %9s  up to date\n", g_files[f].name,
+                   bench_fmt_bytes(sz, sizeof(sz), bytes));
+            continue ;
+        }
+        if (write_file(dir, f, bytes, seed) < 0)
+        {
+            fprintf(stderr, "%s  ✗ %s/%s: %s%s\n", CLR_RED, dir,
+                    g_files[f].name, strerror(errno), CLR_RESET);
+            free(manifest);
+            return (1);
+        }
+        printf("%s  ✓ %-12s %9s  %-32s %6.2f s%s\n", CLR_GREEN, g_files[f].name,
+               bench_fmt_bytes(sz, sizeof(sz), bytes), g_files[f].what,
+               (bench_now_ns() - t0) / 1e9, CLR_RESET);
+    }
+    free(manifest);
+    if (!(fp = fopen(path, "w")))
+    {
+        perror(path);
+        return (1);
+    }
+    for (size_t f = 0; f < FILE_COUNT; f++)
+    {
+        char line[256];
+
+        manifest_line(line, sizeof(line), f, bytes, seed);
+        fputs(line, fp);
+    }
+    return (fclose(fp) == 0 ? 0 : 1);
+}
@@ -0,0 +1,713 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   monsters_mutate.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <dirent.h>
+#include <errno.h>
+#include <sys/wait.h>
+#include "bench_utils.h"
+#include "progress.h"
+
+/* Mutation testing: every libft .c file is scanned for small source
+ * mutations (a flipped comparison, && for ||, a constant off by one),
+ * and each mutant is compiled on its own into a .so. The test suites run
+ * as fork servers (test_runner.c, --fork-server): they start once, and
+ * for each mutant fork a child that jumps from the original functions to
+ * the mutant's. A mutant is killed when some test fails, crashes or
+ * times out with it; the ones that survive show what the suite misses. */
+#define MAX_SERVERS     4
+#define MAX_FILES       256
+#define MAX_FUNCS       32
+#define REPLY_SIZE      512
+#define SNIPPET         56
+
+/* ========== Sources & Mutation Sites ========== */
+
+typedef struct s_site
+{
+    size_t  at;
+    size_t  len;
+    char    with[24];
+    int     line;
+}   t_site;
+
+typedef struct s_source
+{
+    char    path[PATH_MAX];
+    char    file[NAME_MAX + 1];
+    char    name[NAME_MAX + 1];
+    char    *text;
+    size_t  len;
+    t_site  *sites;
+    size_t  n_sites;
+    size_t  cap_sites;
+    char    funcs[MAX_FUNCS * 48];
+    int     killed;
+    int     survived;
+    int     stillborn;
+}   t_source;
+
+static void add_site(t_source *src, size_t at, size_t len, const char *with,
+                     int line)
+{
+    if (src->n_sites == src->cap_sites)
+    {
+        src->cap_sites = src->cap_sites ? src->cap_sites * 2 : 64;
+        src->sites = realloc(src->sites, src->cap_sites * sizeof(*src->sites));
+        if (!src->sites)
+        {
+            perror("monsters_mutate");
+            exit(1);
+        }
+    }
+    src->sites[src->n_sites] = (t_site){at, len, "", line};
+    snprintf(src->sites[src->n_sites++].with, sizeof(src->sites->with), "%s", with);
+}
+
+static const struct
+{
+    const char  *op;
+    const char  *with;
+}   g_swaps[] = {
+    {"<=", "<"}, {">=", ">"}, {"==", "!="}, {"!=", "=="},
+    {"&&", "||"}, {"||", "&&"}, {"<", "<="}, {">", ">="},
+};
+
+/* Operators that start like the ones above but must stay as they are */
+static const char  *g_keep[] = {"<<=", ">>=", "<<", ">>", "->"};
+
+/* Decimal integer constants n become n + 1 and n - 1 */
+static size_t scan_number(t_source *src, size_t i, int line)
+{
+    size_t          end = i;
+    size_t          digits;
+    unsigned long   n;
+    char            with[24];
+
+    while (end < src->len && (isalnum((unsigned char)src->text[end])
+           || src->text[end] == '_' || src->text[end] == '.'))
+        end++;
+    digits = i;
+    while (digits < end && isdigit((unsigned char)src->text[digits]))
+        digits++;
+    if (strspn(src->text + digits, "uUlL") < end - digits
+        || (src->text[i] == '0' && digits - i > 1) || digits - i > 9)
+        return end;
+    n = strtoul(src->text + i, NULL, 10);
+    snprintf(with, sizeof(with), "%lu", n + 1);
+    add_site(src, i, digits - i, with, line);
+    if (n > 0)
+    {
+        snprintf(with, sizeof(with), "%lu", n - 1);
+        add_site(src, i, digits - i, with, line);
+    }
+    return end;
+}
+
+/* Skips a string or character literal starting at i */
+static size_t skip_literal(const t_source *src, size_t i)
+{
+    char quote = src->text[i++];
+
+    while (i < src->len && src->text[i] != quote && src->text[i] != '\n')
+        i += src->text[i] == '\\' ? 2 : 1;
+    return i + 1;
+}
+
+/* Also collects the functions the file defines: the identifier before
+ * the first '(' at file scope, once a '{' follows instead of a ';' */
+static void scan_source(t_source *src)
+{
+    const char  *t = src->text;
+    char        last[48] = "";
+    char        candidate[48] = "";
+    int         depth = 0;
+    int         parens = 0;
+    int         line = 1;
+    int         bol = 1;
+    size_t      i = 0;
+
+    while (i < src->len)
+    {
+        char c = t[i];
+
+        if (c == '\n' || isspace((unsigned char)c))
+        {
+            line += c == '\n';
+            bol |= c == '\n';
+            i++;
+            continue ;
+        }
+        if (c == '#' && bol)
+        {
+            while (i < src->len && (t[i] != '\n' || t[i - 1] == '\\'))
+                line += t[i++] == '\n';
+            continue ;
+        }
+        bol = 0;
+        if (c == '/' && t[i + 1] == '/')
+        {
+            while (i < src->len && t[i] != '\n')
+                i++;
+        }
+        else if (c == '/' && t[i + 1] == '*')
+        {
+            for (i += 2; i < src->len && !(t[i] == '*' && t[i + 1] == '/'); i++)
+                line += t[i] == '\n';
+            i += 2;
+        }
+        else if (c == '"' || c == '\'')
+            i = skip_literal(src, i);
+        else if (isalpha((unsigned char)c) || c == '_')
+        {
+            size_t len = 0;
+
+            while (isalnum((unsigned char)t[i + len]) || t[i + len] == '_')
+                len++;
+            snprintf(last, sizeof(last), "%.*s", (int)len, t + i);
+            i += len;
+            continue ;
+        }
+        else if (isdigit((unsigned char)c))
+            i = scan_number(src, i, line);
+        else
+        {
+            size_t  len = 1;
+            size_t  k;
+
+            for (k = 0; k < sizeof(g_keep) / sizeof(*g_keep); k++)
+                if (strncmp(t + i, g_keep[k], strlen(g_keep[k])) == 0)
+                    break ;
+            if (k < sizeof(g_keep) / sizeof(*g_keep))
+                len = strlen(g_keep[k]);
+            else
+                for (k = 0; k < sizeof(g_swaps) / sizeof(*g_swaps); k++)
+                {
+                    if (strncmp(t + i, g_swaps[k].op, strlen(g_swaps[k].op)) != 0)
+                        continue ;
+                    len = strlen(g_swaps[k].op);
+                    add_site(src, i, len, g_swaps[k].with, line);
+                    break ;
+                }
+            if (c == '(' && depth == 0 && parens++ == 0 && last[0])
+                memcpy(candidate, last, sizeof(last));
+            else if (c == ')' && parens > 0)
+                parens--;
+            else if (c == ';' && depth == 0)
+                candidate[0] = '\0';
+            else if (c == '{' && depth++ == 0 && candidate[0]
+                     && strlen(src->funcs) + strlen(candidate) + 2 < sizeof(src->funcs))
+            {
+                strcat(strcat(src->funcs, " "), candidate);
+                candidate[0] = '\0';
+            }
+            else if (c == '}' && depth > 0)
+                depth--;
+            i += len;
+        }
+        last[0] = '\0';
+    }
+}
+
+static int load_source(t_source *src, const char *dir, const char *file)
+{
+    FILE    *fp;
+    long    len;
+    char    *bonus;
+
+    memset(src, 0, sizeof(*src));
+    snprintf(src->path, sizeof(src->path), "%s/%s", dir, file);
+    snprintf(src->file, sizeof(src->file), "%s", file);
+    snprintf(src->name, sizeof(src->name), "%.*s", (int)strlen(file) - 2, file);
+    if ((bonus = strstr(src->name, "_bonus")) && bonus[6] == '\0')
+        *bonus = '\0';
+    if (!(fp = fopen(src->path, "rb")))
+        return -1;
+    fseek(fp, 0, SEEK_END);
+    len = ftell(fp);
+    rewind(fp);
+    src->text = calloc(len + 2, 1);
+    if (len < 0 || !src->text || fread(src->text, 1, len, fp) != (size_t)len)
+    {
+        fclose(fp);
+        return -1;
+    }
+    fclose(fp);
+    src->len = len;
+    scan_source(src);
+    return 0;
+}
+
+static int by_name(const void *a, const void *b)
+{
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+/* "ft_strlcat", "strlcat" or "ft_strlcat.c" all select ft_strlcat.c */
+static int selected(const char *file, const char *only)
+{
+    char    list[1024];
+    char    *save;
+
+    if (!only)
+        return 1;
+    snprintf(list, sizeof(list), "%s", only);
+    for (char *w = strtok_r(list, ", ", &save); w; w = strtok_r(NULL, ", ", &save))
+    {
+        const char  *f = file;
+        size_t      len = strlen(w);
+
+        if (strncmp(w, "ft_", 3) != 0 && strncmp(f, "ft_", 3) == 0)
+            f += 3;
+        if (strncmp(f, w, len) == 0 && (strcmp(f + len, ".c") == 0
+            || strcmp(f + len, "_bonus.c") == 0 || f[len] == '\0'))
+            return 1;
+    }
+    return 0;
+}
+
+static size_t load_sources(t_source *srcs, const char *dir, const char *only)
+{
+    DIR             *d = opendir(dir);
+    struct dirent   *e;
+    char            *names[MAX_FILES];
+    size_t          n = 0;
+    size_t          count = 0;
+
+    if (!d)
+    {
+        perror(dir);
+        exit(1);
+    }
+    while ((e = readdir(d)) && n < MAX_FILES)
+    {
+        size_t len = strlen(e->d_name);
+
+        if (len > 2 && strcmp(e->d_name + len - 2, ".c") == 0
+            && selected(e->d_name, only))
+            names[n++] = strdup(e->d_name);
+    }
+    closedir(d);
+    qsort(names, n, sizeof(*names), by_name);
+    for (size_t i = 0; i < n; i++)
+    {
+        if (load_source(&srcs[count], dir, names[i]) == 0)
+            count++;
+        else
+            perror(names[i]);
+        free(names[i]);
+    }
+    return count;
+}
+
+/* ========== Building Mutants ========== */
+
+typedef struct s_mutate
+{
+    const char  *libft;
+    const char  *cc;
+    const char  *cflags;
+    const char  *ldflags;
+    const char  *out;
+    const char  *only;
+    const char  *timeout;
+    int         list;
+    const char  *servers[MAX_SERVERS];
+    int         n_servers;
+}   t_mutate;
+
+static void write_mutant(const t_source *src, const t_site *s, const char *path)
+{
+    FILE *fp = fopen(path, "wb");
+
+    if (!fp || fwrite(src->text, 1, s->at, fp) != s->at
+        || fputs(s->with, fp) < 0
+        || fwrite(src->text + s->at + s->len, 1, src->len - s->at - s->len, fp)
+           != src->len - s->at - s->len
+        || fclose(fp) != 0)
+    {
+        perror(path);
+        exit(1);
+    }
+}
+
+/* Splits each of the space-separated flag strings into argv */
+static int add_words(char **argv, int argc, char *words)
+{
+    char *save;
+
+    for (char *w = strtok_r(words, " ", &save); w && argc < 62;
+         w = strtok_r(NULL, " ", &save))
+        argv[argc++] = w;
+    return argc;
+}
+
+/* cc <cflags> -w -fPIC -shared -o X.so X.c <ldflags>; the compiler's
+ * complaints about broken mutants are not interesting */
+static int compile(const t_mutate *m, const char *c_path, const char *so_path)
+{
+    char    cc[256];
+    char    cflags[1024];
+    char    ldflags[1024];
+    char    *argv[64];
+    int     argc = 0;
+    int     status;
+    pid_t   pid;
+
+    snprintf(cc, sizeof(cc), "%s", m->cc);
+    snprintf(cflags, sizeof(cflags), "%s -w -fPIC -shared -o", m->cflags);
+    snprintf(ldflags, sizeof(ldflags), "%s", m->ldflags);
+    argc = add_words(argv, argc, cc);
+    argc = add_words(argv, argc, cflags);
+    argv[argc++] = (char *)so_path;
+    argv[argc++] = (char *)c_path;
+    argc = add_words(argv, argc, ldflags);
+    argv[argc] = NULL;
+    if ((pid = fork()) < 0)
+        return -1;
+    if (pid == 0)
+    {
+        int null = open("/dev/null", O_WRONLY);
+
+        dup2(null, STDERR_FILENO);
+        dup2(null, STDOUT_FILENO);
+        execvp(argv[0], argv);
+        _exit(127);
+    }
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0 ? 0 : -1;
+}
+
+/* ========== Fork Servers ========== */
+
+typedef struct s_server
+{
+    const char  *bin;
+    pid_t       pid;
+    FILE        *in;
+    FILE        *out;
+}   t_server;
+
+static t_server g_servers[MAX_SERVERS];
+
+static int read_reply(t_server *s, char *reply)
+{
+    if (!fgets(reply, REPLY_SIZE, s->out))
+        return -1;
+    reply[strcspn(reply, "\n")] = '\0';
+    return 0;
+}
+
+/* The suite prints its banner before it reaches the server loop, so
+ * everything up to the "ready" line is skipped. Our pipe ends are
+ * close-on-exec, or the next server would hold this one's stdin open. */
+static void start_server(t_server *s, const char *bin, const char *timeout)
+{
+    int     to[2];
+    int     from[2];
+    char    reply[REPLY_SIZE];
+
+    s->bin = bin;
+    if (pipe(to) < 0 || pipe(from) < 0 || (s->pid = fork()) < 0)
+    {
+        perror("monsters_mutate: fork");
+        exit(1);
+    }
+    if (s->pid == 0)
+    {
+        int null = open("/dev/null", O_WRONLY);
+
+        dup2(to[0], STDIN_FILENO);
+        dup2(from[1], STDOUT_FILENO);
+        dup2(null, STDERR_FILENO);
+        close(to[1]);
+        close(from[0]);
+        execl(bin, bin, "--fork-server", "--timeout", timeout, (char *)NULL);
+        _exit(127);
+    }
+    close(to[0]);
+    close(from[1]);
+    fcntl(to[1], F_SETFD, FD_CLOEXEC);
+    fcntl(from[0], F_SETFD, FD_CLOEXEC);
+    s->in = fdopen(to[1], "w");
+    s->out = fdopen(from[0], "r");
+    while (s->out && read_reply(s, reply) == 0)
+        if (strcmp(reply, "ready") == 0)
+            return ;
+    fprintf(stderr, "%s❌ %s did not start as a fork server%s\n", CLR_RED, bin,
+            CLR_RESET);
+    exit(1);
+}
+
+static void ask(t_server *s, const char *request, char *reply)
+{
+    if (fprintf(s->in, "%s\n", request) < 0 || fflush(s->in) != 0
+        || read_reply(s, reply) < 0)
+    {
+        fprintf(stderr, "%s❌ fork server %s died%s\n", CLR_RED, s->bin, CLR_RESET);
+        exit(1);
+    }
+    if (strncmp(reply, "error", 5) == 0)
+    {
+        fprintf(stderr, "%s❌ %s: %s%s\n", CLR_RED, s->bin, reply + 6, CLR_RESET);
+        exit(1);
+    }
+}
+
+static void stop_servers(int n)
+{
+    for (int i = 0; i < n; i++)
+    {
+        fclose(g_servers[i].in);
+        fclose(g_servers[i].out);
+        waitpid(g_servers[i].pid, NULL, 0);
+    }
+}
+
+/* Mutation testing only means something if the suite passes as it is */
+static void check_baseline(int n)
+{
+    char reply[REPLY_SIZE];
+
+    for (int i = 0; i < n; i++)
+    {
+        ask(&g_servers[i], "-", reply);
+        if (strcmp(reply, "survived") != 0)
+        {
+            fprintf(stderr, "%s❌ %s fails on the unmutated libft (%s)%s\n",
+                    CLR_RED, g_servers[i].bin, reply, CLR_RESET);
+            exit(1);
+        }
+    }
+}
+
+/* ========== Running Mutants ========== */
+
+static void print_snippet(const t_source *src, const t_site *s)
+{
+    size_t  from = s->at;
+    size_t  to = s->at + s->len;
+
+    while (from > 0 && src->text[from - 1] != '\n' && s->at - from < SNIPPET / 2)
+        from--;
+    while (isspace((unsigned char)src->text[from]) && from < s->at)
+        from++;
+    while (to < src->len && src->text[to] != '\n' && to - s->at < SNIPPET / 2)
+        to++;
+    printf("%.*s%s%s%s%.*s", (int)(s->at - from), src->text + from,
+           CLR_YELLOW, s->with, CLR_RESET,
+           (int)(to - s->at - s->len), src->text + s->at + s->len);
+}
+
+static void print_mutant(const t_source *src, const t_site *s, const char *note)
+{
+    printf("  %s%s:%d%s  %.*s → %s  ", CLR_BOLD, src->file, s->line, CLR_RESET,
+           (int)s->len, src->text + s->at, s->with);
+    print_snippet(src, s);
+    printf("%s%s%s\n", CLR_CYAN, note, CLR_RESET);
+}
+
+/* Asks each server in turn until one kills the mutant. Survivors are
+ * printed at once; "unreached" means no suite links that function. */
+static void run_mutant(const t_mutate *m, t_source *src, const t_site *s)
+{
+    char    c_path[PATH_MAX];
+    char    so_path[PATH_MAX];
+    char    request[PATH_MAX + sizeof(src->funcs)];
+    char    reply[REPLY_SIZE];
+    int     reached = 0;
+
+    snprintf(c_path, sizeof(c_path), "%s/%s", m->out, src->file);
+    snprintf(so_path, sizeof(so_path), "%s/%s.so", m->out, src->name);
+    write_mutant(src, s, c_path);
+    if (compile(m, c_path, so_path) < 0)
+    {
+        src->stillborn++;
+        progress_add(1, 0, 0);
+        return ;
+    }
+    snprintf(request, sizeof(request), "%s%s", so_path, src->funcs);
+    for (int i = 0; i < m->n_servers; i++)
+    {
+        ask(&g_servers[i], request, reply);
+        if (strncmp(reply, "killed", 6) == 0)
+        {
+            src->killed++;
+            progress_add(1, 1, 0);
+            return ;
+        }
+        reached |= strcmp(reply, "survived") == 0;
+    }
+    src->survived++;
+    progress_add(1, 0, 1);
+    progress_hold();
+    print_mutant(src, s, reached ? "" : "  (not called by any suite)");
+    progress_release();
+}
+
+static void print_bar(double score)
+{
+    int cells = (int)(score / 5 + 0.5);
+
+    for (int i = 0; i < 20; i++)
+        printf("%s", i < cells ? "█" : "░");
+}
+
+static const char *score_color(double score)
+{
+    if (score >= 90)
+        return CLR_GREEN;
+    return score >= 70 ? CLR_YELLOW : CLR_RED;
+}
+
+static void report(const t_source *srcs, size_t n, double secs)
+{
+    int     killed = 0;
+    int     survived = 0;
+    int     stillborn = 0;
+    double  score;
+
+    printf("\n%s%s🧬 Mutation score per function%s\n", CLR_BOLD, CLR_CYAN, CLR_RESET);
+    printf("  %-20s %8s %8s %9s %7s\n", "function", "mutants", "killed",
+           "survived", "score");
+    for (size_t i = 0; i < n; i++)
+    {
+        int total = srcs[i].killed + srcs[i].survived;
+
+        killed += srcs[i].killed;
+        survived += srcs[i].survived;
+        stillborn += srcs[i].stillborn;
+        if (!total)
+            continue ;
+        score = 100.0 * srcs[i].killed / total;
+        printf("  %-20s %8d %8d %9d %s%6.1f%%%s  ", srcs[i].name, total,
+               srcs[i].killed, srcs[i].survived, score_color(score), score,
+               CLR_RESET);
+        print_bar(score);
+        printf("\n");
+    }
+    score = killed + survived ? 100.0 * killed / (killed + survived) : 0;
+    printf("  %-20s %8d %8d %9d %s%6.1f%%%s\n", "total", killed + survived,
+           killed, survived, score_color(score), score, CLR_RESET);
+    printf("\n  %d mutants did not compile and are not counted; %.1f s, "
+           "%.1f mutants/s\n", stillborn, secs,
+           secs > 0 ? (killed + survived + stillborn) / secs : 0);
+    metric("mutation.score", score, "%");
+    metric("mutation.survived", survived, "count");
+}
+
+/* ========== Main ========== */
+
+static void usage(const char *prog)
+{
+    printf("usage: %s --server BIN [--server BIN]... [options]\n"
+           "  --libft DIR        libft sources (default ..)\n"
+           "  --only LIST        only these functions, e.g. strlcat,ft_substr\n"
+           "  --cc CC            compiler for the mutants (default cc)\n"
+           "  --cflags FLAGS     flags for the mutants, e.g. \"-I..\"\n"
+           "  --ldflags FLAGS    link flags for the mutants (the --wrap list)\n"
+           "  --out DIR          where mutants are built (default build/mutate/mutants)\n"
+           "  --timeout SEC      per-test budget inside the servers (default 2)\n"
+           "  --list             print the mutants without running them\n",
+           prog);
+}
+
+static void parse_args(t_mutate *m, int argc, char **argv)
+{
+    *m = (t_mutate){"..", "cc", "", "", "build/mutate/mutants", NULL, "2", 0,
+                    {NULL}, 0};
+    for (int i = 1; i < argc; i++)
+    {
+        const char  **opt = NULL;
+
+        if (strcmp(argv[i], "--list") == 0)
+        {
+            m->list = 1;
+            continue ;
+        }
+        if (strcmp(argv[i], "--libft") == 0)
+            opt = &m->libft;
+        else if (strcmp(argv[i], "--only") == 0)
+            opt = &m->only;
+        else if (strcmp(argv[i], "--cc") == 0)
+            opt = &m->cc;
+        else if (strcmp(argv[i], "--cflags") == 0)
+            opt = &m->cflags;
+        else if (strcmp(argv[i], "--ldflags") == 0)
+            opt = &m->ldflags;
+        else if (strcmp(argv[i], "--out") == 0)
+            opt = &m->out;
+        else if (strcmp(argv[i], "--timeout") == 0)
+            opt = &m->timeout;
+        else if (strcmp(argv[i], "--server") == 0 && m->n_servers < MAX_SERVERS)
+            opt = &m->servers[m->n_servers++];
+        if (!opt || i + 1 >= argc)
+        {
+            usage(argv[0]);
+            exit(2);
+        }
+        *opt = argv[++i];
+    }
+    if (!m->list && !m->n_servers)
+    {
+        usage(argv[0]);
+        exit(2);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    static t_source srcs[MAX_FILES];
+    t_mutate        m;
+    size_t          n;
+    size_t          total = 0;
+    uint64_t        t0;
+
+    setvbuf(stdout, NULL, _IONBF, 0);
+    parse_args(&m, argc, argv);
+    n = load_sources(srcs, m.libft, m.only);
+    for (size_t i = 0; i < n; i++)
+        total += srcs[i].n_sites;
+    printf("\n%s🧬 %zu mutants in %zu file%s under %s%s\n", CLR_CYAN, total, n,
+           n == 1 ? "" : "s", m.libft, CLR_RESET);
+    if (m.list)
+    {
+        for (size_t i = 0; i < n; i++)
+            for (size_t k = 0; k < srcs[i].n_sites; k++)
+                print_mutant(&srcs[i], &srcs[i].sites[k], "");
+        return (0);
+    }
+    if (mkdir(m.out, 0755) < 0 && errno != EEXIST)
+    {
+        perror(m.out);
+        return (1);
+    }
+    for (int i = 0; i < m.n_servers; i++)
+        start_server(&g_servers[i], m.servers[i], m.timeout);
+    check_baseline(m.n_servers);
+    printf("%s🧟 Surviving mutants%s\n", CLR_YELLOW, CLR_RESET);
+    t0 = bench_now_ns();
+    progress_start("mutants", total, 0, 1);
+    for (size_t i = 0; i < n; i++)
+    {
+        progress_current(srcs[i].name);
+        for (size_t k = 0; k < srcs[i].n_sites; k++)
+            run_mutant(&m, &srcs[i], &srcs[i].sites[k]);
+    }
+    progress_stop();
+    stop_servers(m.n_servers);
+    report(srcs, n, (bench_now_ns() - t0) / 1e9);
+    for (size_t i = 0; i < n; i++)
+    {
+        free(srcs[i].text);
+        free(srcs[i].sites);
+    }
+    return (0);
+}
@@ -0,0 +1,526 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   monsters_prop.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench_utils.h"
+#include "progress.h"
+
+int tests_run = 0;
+int tests_passed = 0;
+
+/* Every case is generated from (seed, case index) alone, so any case can
+ * be rebuilt on any thread, replayed with --replay, and shrunk after the
+ * parallel run has stopped. */
+#define MAX_STR         256
+#define DEFAULT_CASES   1000000
+#define DEFAULT_SEED    0x5EEDull
+#define BATCH           4096
+#define WHY_SIZE        128
+
+/* ========== Cases & Generators ========== */
+
+typedef struct s_case
+{
+    unsigned char   a[MAX_STR + 1];
+    size_t          alen;
+    unsigned char   b[MAX_STR + 1];
+    size_t          blen;
+    unsigned int    start;
+    size_t          len;
+}   t_case;
+
+/* Small alphabets make s and set collide often; the others bring
+ * whitespace, bytes >= 0x80 (negative as char) and anything but NUL. */
+static unsigned char gen_byte(uint64_t *rng, int alphabet)
+{
+    uint64_t r = bench_rand64(rng);
+
+    if (alphabet == 0)
+        return "abc"[r % 3];
+    if (alphabet == 1)
+        return " \t\nx"[r % 4];
+    if (alphabet == 2)
+        return 0x80 + r % 128;
+    return 1 + r % 255;
+}
+
+static size_t gen_string(uint64_t *rng, unsigned char *dst, int alphabet)
+{
+    uint64_t    r = bench_rand64(rng) % 16;
+    size_t      len;
+
+    if (r < 10)
+        len = r;
+    else if (r < 14)
+        len = bench_rand64(rng) % 64;
+    else
+        len = bench_rand64(rng) % (MAX_STR + 1);
+    for (size_t i = 0; i < len; i++)
+        dst[i] = gen_byte(rng, alphabet < 4 ? alphabet : (int)(bench_rand64(rng) % 4));
+    dst[len] = '\0';
+    return len;
+}
+
+static unsigned int gen_start(uint64_t *rng, size_t alen)
+{
+    uint64_t r = bench_rand64(rng);
+
+    switch (r % 7)
+    {
+        case 0: return 0;
+        case 1: return alen;
+        case 2: return alen + 1 + (r >> 8) % 8;
+        case 3: return UINT_MAX;
+        case 4: return (unsigned int)(r >> 32);
+        default: return (r >> 8) % (alen + 1);
+    }
+}
+
+static size_t gen_len(uint64_t *rng, size_t alen, unsigned int start)
+{
+    uint64_t r = bench_rand64(rng);
+
+    switch (r % 8)
+    {
+        case 0: return 0;
+        case 1: return start < alen ? alen - start : 0;
+        case 2: return SIZE_MAX;
+        case 3: return SIZE_MAX - start;
+        case 4: return (size_t)UINT_MAX + 1;
+        case 5: return r >> 3;
+        default: return (r >> 8) % (alen + 3);
+    }
+}
+
+static void gen_case(t_case *c, uint64_t seed, size_t index)
+{
+    /* splitmix64 turns (seed, index) into a well-mixed nonzero state */
+    uint64_t    rng = seed + (index + 1) * 0x9E3779B97F4A7C15ull;
+    int         alphabet;
+
+    rng = (rng ^ (rng >> 30)) * 0xBF58476D1CE4E5B9ull;
+    rng = (rng ^ (rng >> 27)) * 0x94D049BB133111EBull;
+    rng = (rng ^ (rng >> 31)) | 1;
+    alphabet = bench_rand64(&rng) % 5;
+    c->alen = gen_string(&rng, c->a, alphabet);
+    c->blen = gen_string(&rng, c->b, alphabet);
+    c->start = gen_start(&rng, c->alen);
+    c->len = gen_len(&rng, c->alen, c->start);
+}
+
+/* ========== Properties ========== */
+
+/* strlen(ft_substr(s, st, len)) == min(len, max(0, strlen(s) - st)),
+ * and the bytes are those of s at st */
+static int check_substr(const t_case *c, char *why)
+{
+    size_t  avail = c->start < c->alen ? c->alen - c->start : 0;
+    size_t  want = c->len < avail ? c->len : avail;
+    char    *res = ft_substr((const char *)c->a, c->start, c->len);
+    size_t  got;
+    int     ok;
+
+    if (!res)
+        return (snprintf(why, WHY_SIZE, "returned NULL"), 0);
+    got = strlen(res);
+    ok = got == want && memcmp(res, c->a + (want ? c->start : 0), want) == 0;
+    if (!ok)
+        snprintf(why, WHY_SIZE, "strlen %zu, expected %zu%s", got, want,
+                 got == want ? " (bytes differ)" : "");
+    free(res);
+    return ok;
+}
+
+/* ft_strjoin(a, b) is exactly a followed by b */
+static int check_strjoin(const t_case *c, char *why)
+{
+    char    *res = ft_strjoin((const char *)c->a, (const char *)c->b);
+    size_t  got;
+    int     ok;
+
+    if (!res)
+        return (snprintf(why, WHY_SIZE, "returned NULL"), 0);
+    got = strlen(res);
+    ok = got == c->alen + c->blen && memcmp(res, c->a, c->alen) == 0
+        && memcmp(res + c->alen, c->b, c->blen) == 0;
+    if (!ok)
+        snprintf(why, WHY_SIZE, "strlen %zu, expected %zu%s", got,
+                 c->alen + c->blen, got == c->alen + c->blen ? " (bytes differ)" : "");
+    free(res);
+    return ok;
+}
+
+/* ft_strtrim(s, set) is the longest slice of s that neither starts nor
+ * ends with a byte of set */
+static int check_strtrim(const t_case *c, char *why)
+{
+    size_t  lo = 0;
+    size_t  hi = c->alen;
+    char    *res = ft_strtrim((const char *)c->a, (const char *)c->b);
+    size_t  got;
+    int     ok;
+
+    while (lo < hi && memchr(c->b, c->a[lo], c->blen))
+        lo++;
+    while (hi > lo && memchr(c->b, c->a[hi - 1], c->blen))
+        hi--;
+    if (!res)
+        return (snprintf(why, WHY_SIZE, "returned NULL"), 0);
+    got = strlen(res);
+    ok = got == hi - lo && memcmp(res, c->a + lo, got) == 0;
+    if (!ok)
+        snprintf(why, WHY_SIZE, "strlen %zu, expected %zu%s", got, hi - lo,
+                 got == hi - lo ? " (bytes differ)" : "");
+    free(res);
+    return ok;
+}
+
+typedef struct s_prop
+{
+    const char  *name;
+    int         (*check)(const t_case *c, char *why);
+    const char  *a_name;
+    const char  *b_name;
+    int         numbers;
+}   t_prop;
+
+static const t_prop g_props[] = {
+    {"ft_substr", check_substr, "s", NULL, 1},
+    {"ft_strjoin", check_strjoin, "s1", "s2", 0},
+    {"ft_strtrim", check_strtrim, "s1", "set", 0},
+};
+
+/* ========== Printing ========== */
+
+static void print_bytes(const char *label, const unsigned char *s, size_t n)
+{
+    printf(" %s=\"", label);
+    for (size_t i = 0; i < n; i++)
+    {
+        if (s[i] == '"' || s[i] == '\\')
+            printf("\\%c", s[i]);
+        else if (s[i] >= 0x20 && s[i] < 0x7f)
+            putchar(s[i]);
+        else
+            printf("\\x%02x", s[i]);
+    }
+    printf("\" (%zu)", n);
+}
+
+static void print_case(const char *title, const t_prop *p, const t_case *c)
+{
+    printf("      %s:", title);
+    print_bytes(p->a_name, c->a, c->alen);
+    if (p->b_name)
+        print_bytes(p->b_name, c->b, c->blen);
+    if (p->numbers)
+    {
+        printf(c->start == UINT_MAX ? " start=UINT_MAX" : " start=%u", c->start);
+        if (c->len == SIZE_MAX)
+            printf(" len=SIZE_MAX");
+        else
+            printf(" len=%zu", c->len);
+    }
+    printf("\n");
+}
+
+/* ========== Shrinking ========== */
+
+static int fails(const t_prop *p, const t_case *c)
+{
+    char why[WHY_SIZE];
+
+    return !p->check(c, why);
+}
+
+/* Drops chunks of halving size, then replaces bytes with 'a' */
+static int shrink_string(const t_prop *p, t_case *c, int which)
+{
+    unsigned char   *s = which ? c->b : c->a;
+    size_t          *n = which ? &c->blen : &c->alen;
+    t_case          save;
+    int             progress = 0;
+
+    for (size_t chunk = *n / 2 ? *n / 2 : 1; *n && chunk; chunk /= 2)
+    {
+        for (size_t pos = 0; pos + chunk <= *n; )
+        {
+            save = *c;
+            memmove(s + pos, s + pos + chunk, *n - pos - chunk + 1);
+            *n -= chunk;
+            if (fails(p, c))
+                progress = 1;
+            else
+            {
+                *c = save;
+                pos += chunk;
+            }
+        }
+    }
+    for (size_t i = 0; i < *n; i++)
+    {
+        unsigned char old = s[i];
+
+        if (old == 'a')
+            continue;
+        s[i] = 'a';
+        if (fails(p, c))
+            progress = 1;
+        else
+            s[i] = old;
+    }
+    return progress;
+}
+
+/* Bisects start (field 0) or len (field 1) down to the smallest value
+ * that still fails, taking 0 as the known-passing lower bound */
+static void set_number(t_case *c, int field, size_t v)
+{
+    if (field)
+        c->len = v;
+    else
+        c->start = (unsigned int)v;
+}
+
+static int shrink_number(const t_prop *p, t_case *c, int field)
+{
+    size_t  orig = field ? c->len : c->start;
+    size_t  hi = orig;
+    size_t  lo = 0;
+
+    if (hi == 0)
+        return 0;
+    set_number(c, field, 0);
+    if (fails(p, c))
+        return 1;
+    while (hi - lo > 1)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+
+        set_number(c, field, mid);
+        if (fails(p, c))
+            hi = mid;
+        else
+            lo = mid;
+    }
+    set_number(c, field, hi);
+    return hi != orig;
+}
+
+static void shrink(const t_prop *p, t_case *c)
+{
+    int progress = 1;
+
+    while (progress)
+    {
+        progress = shrink_string(p, c, 0);
+        if (p->b_name)
+            progress |= shrink_string(p, c, 1);
+        if (p->numbers)
+        {
+            progress |= shrink_number(p, c, 0);
+            progress |= shrink_number(p, c, 1);
+        }
+    }
+}
+
+/* ========== Parallel Runner ========== */
+
+/* Threads claim BATCH case indices at a time; the first failure stops
+ * everyone, and the lowest failing index seen is kept so the report does
+ * not depend on the thread count. */
+typedef struct s_run
+{
+    const t_prop    *prop;
+    uint64_t        seed;
+    size_t          cases;
+    size_t          next;
+    int             failed;
+    size_t          fail_index;
+    pthread_mutex_t lock;
+}   t_run;
+
+/* A crash cannot be shrunk, but the case that caused it can be named */
+static __thread const t_prop    *g_cur_prop;
+static __thread size_t          g_cur_index;
+static uint64_t                 g_seed;
+
+static void on_crash(int sig)
+{
+    char    msg[256];
+    int     len;
+
+    len = snprintf(msg, sizeof(msg), "\n%s  💥 %s crashed (%s) on case #%zu of "
+                   "seed 0x%llx: rerun with --only %s --seed 0x%llx --replay %zu%s\n",
+                   CLR_RED, g_cur_prop ? g_cur_prop->name : "?", strsignal(sig),
+                   g_cur_index, (unsigned long long)g_seed,
+                   g_cur_prop ? g_cur_prop->name : "?", (unsigned long long)g_seed,
+                   g_cur_index, CLR_RESET);
+    if (write(STDOUT_FILENO, msg, len) < 0)
+        _exit(2);
+    _exit(1);
+}
+
+static void *prop_worker(void *arg)
+{
+    t_run   *run = arg;
+    t_case  c;
+    char    why[WHY_SIZE];
+
+    g_cur_prop = run->prop;
+    while (!__atomic_load_n(&run->failed, __ATOMIC_RELAXED))
+    {
+        size_t first = __atomic_fetch_add(&run->next, BATCH, __ATOMIC_RELAXED);
+        size_t last = first + BATCH < run->cases ? first + BATCH : run->cases;
+
+        if (first >= run->cases)
+            break ;
+        for (size_t i = first; i < last; i++)
+        {
+            g_cur_index = i;
+            gen_case(&c, run->seed, i);
+            if (run->prop->check(&c, why))
+                continue ;
+            pthread_mutex_lock(&run->lock);
+            if (!run->failed || i < run->fail_index)
+                run->fail_index = i;
+            __atomic_store_n(&run->failed, 1, __ATOMIC_RELAXED);
+            pthread_mutex_unlock(&run->lock);
+            progress_add(i - first + 1, i - first, 1);
+            return NULL;
+        }
+        progress_add(last - first, last - first, 0);
+    }
+    return NULL;
+}
+
+static void run_prop(const t_prop *p, size_t cases, int threads, uint64_t seed)
+{
+    t_run       run = {p, seed, cases, 0, 0, 0, PTHREAD_MUTEX_INITIALIZER};
+    pthread_t   tids[threads];
+    uint64_t    t0 = bench_now_ns();
+    double      secs;
+    char        msg[WHY_SIZE + 128];
+    char        why[WHY_SIZE];
+    char        key[64];
+    t_case      c;
+
+    printf("\n%s=== %s ===%s\n", CLR_YELLOW, p->name, CLR_RESET);
+    progress_start("cases", cases, 0, 1);
+    progress_current(p->name);
+    for (int i = 0; i < threads; i++)
+        pthread_create(&tids[i], NULL, prop_worker, &run);
+    for (int i = 0; i < threads; i++)
+        pthread_join(tids[i], NULL);
+    progress_stop();
+    secs = (bench_now_ns() - t0) / 1e9;
+    if (!run.failed)
+    {
+        snprintf(msg, sizeof(msg), "%s: %zu random cases (%.2f M cases/s on %d "
+                 "thread%s)", p->name, cases, cases / secs / 1e6, threads,
+                 threads == 1 ? "" : "s");
+        result_ok(msg);
+        snprintf(key, sizeof(key), "prop.%s", p->name + 3);
+        metric(key, cases / secs, "cases/s");
+        return ;
+    }
+    g_cur_index = run.fail_index;
+    gen_case(&c, seed, run.fail_index);
+    p->check(&c, why);
+    snprintf(msg, sizeof(msg), "%s: case #%zu of seed 0x%llx: %s", p->name,
+             run.fail_index, (unsigned long long)seed, why);
+    result_ko(msg);
+    print_case("original", p, &c);
+    shrink(p, &c);
+    p->check(&c, why);
+    print_case("minimal ", p, &c);
+    printf("      %s→ %s%s\n", CLR_RED, why, CLR_RESET);
+}
+
+static void replay(const t_prop *p, uint64_t seed, size_t index)
+{
+    char    why[WHY_SIZE];
+    char    msg[WHY_SIZE + 64];
+    t_case  c;
+
+    printf("\n%s=== %s: case #%zu ===%s\n", CLR_YELLOW, p->name, index, CLR_RESET);
+    gen_case(&c, seed, index);
+    print_case("case", p, &c);
+    g_cur_index = index;
+    if (p->check(&c, why))
+    {
+        snprintf(msg, sizeof(msg), "%s: case #%zu", p->name, index);
+        result_ok(msg);
+    }
+    else
+    {
+        snprintf(msg, sizeof(msg), "%s: case #%zu: %s", p->name, index, why);
+        result_ko(msg);
+    }
+}
+
+/* ========== Main ========== */
+
+static void usage(const char *prog)
+{
+    printf("usage: %s [--cases N] [--threads N] [--seed S] [--only FUNC]\n"
+           "       %*s [--replay INDEX]\n", prog, (int)strlen(prog), "");
+}
+
+int main(int argc, char **argv)
+{
+    size_t      cases = DEFAULT_CASES;
+    long        threads = sysconf(_SC_NPROCESSORS_ONLN);
+    const char  *only = NULL;
+    long long   replay_index = -1;
+    size_t      n_props = sizeof(g_props) / sizeof(g_props[0]);
+
+    setvbuf(stdout, NULL, _IONBF, 0);
+    g_seed = DEFAULT_SEED;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--cases") == 0 && i + 1 < argc)
+            cases = (size_t)bench_parse_count(argv[++i]);
+        else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            threads = atol(argv[++i]);
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            g_seed = strtoull(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "--only") == 0 && i + 1 < argc)
+            only = argv[++i];
+        else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc)
+            replay_index = atoll(argv[++i]);
+        else
+        {
+            usage(argv[0]);
+            return (2);
+        }
+    }
+    if (threads < 1)
+        threads = 1;
+    signal(SIGSEGV, on_crash);
+    signal(SIGBUS, on_crash);
+    signal(SIGABRT, on_crash);
+
+    part_header("PROPERTY TESTS: substr / strjoin / strtrim");
+    for (size_t i = 0; i < n_props; i++)
+    {
+        if (only && strcmp(only, g_props[i].name) != 0
+            && strcmp(only, g_props[i].name + 3) != 0)
+            continue ;
+        g_cur_prop = &g_props[i];
+        if (replay_index >= 0)
+            replay(&g_props[i], g_seed, (size_t)replay_index);
+        else
+            run_prop(&g_props[i], cases, (int)threads, g_seed);
+    }
+
+    summary();
+    return (tests_run == tests_passed ? 0 : 1);
+}
@@ -0,0 +1,675 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   monsters_stress.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench_utils.h"
+#include "progress.h"
+
+int tests_run = 0;
+int tests_passed = 0;
+
+/* N threads call the pure ft_* functions in a loop and check every result
+ * right after the call: a hidden static buffer or global is overwritten by
+ * another thread between the call and the check. Lists are per thread. */
+
+#define DEFAULT_DURATION    2.0
+#define STR_MAX             96
+#define LIST_MAX            64
+#define WHY_SIZE            160
+
+/* ========== Helper Functions ========== */
+
+static void rand_string(uint64_t *rng, char *dst, size_t max, const char *alphabet)
+{
+    size_t  n = bench_rand64(rng) % max;
+    size_t  k = strlen(alphabet);
+
+    for (size_t i = 0; i < n; i++)
+        dst[i] = alphabet[bench_rand64(rng) % k];
+    dst[n] = '\0';
+}
+
+static char shift_by_index(unsigned int i, char c)
+{
+    return (char)(c + (i % 3));
+}
+
+static void shift_in_place(unsigned int i, char *c)
+{
+    *c = (char)(*c + (i % 3));
+}
+
+static void *double_content(void *content)
+{
+    return (void *)((intptr_t)content * 2);
+}
+
+static void del_nothing(void *content)
+{
+    (void)content;
+}
+
+static __thread intptr_t g_iter_sum;
+
+static void iter_sum(void *content)
+{
+    g_iter_sum += (intptr_t)content;
+}
+
+/* ========== Operations ========== */
+
+/* Each op makes one call with fresh random input, checks it and returns
+ * 1, or fills why and returns 0 */
+typedef int (*t_op_fn)(uint64_t *rng, char *why);
+
+static int op_split(uint64_t *rng, char *why)
+{
+    char        s[STR_MAX];
+    char        **tab;
+    size_t      words = 0;
+    size_t      k = 0;
+    const char  *p = s;
+    int         ok;
+
+    rand_string(rng, s, sizeof(s), "ab,,");
+    for (size_t i = 0; s[i]; i++)
+        words += s[i] != ',' && (i == 0 || s[i - 1] == ',');
+    if (!(tab = ft_split(s, ',')))
+        return (snprintf(why, WHY_SIZE, "ft_split(\"%.40s\", ',') returned NULL", s), 0);
+    while (tab[k])
+        k++;
+    ok = k == words;
+    for (k = 0; ok && k < words; k++)
+    {
+        size_t len;
+
+        p += strspn(p, ",");
+        len = strcspn(p, ",");
+        ok = strlen(tab[k]) == len && strncmp(tab[k], p, len) == 0;
+        p += len;
+    }
+    if (!ok)
+        snprintf(why, WHY_SIZE, "ft_split(\"%.40s\", ','): wrong words", s);
+    for (size_t i = 0; tab[i]; i++)
+        free(tab[i]);
+    free(tab);
+    return ok;
+}
+
+static int op_itoa(uint64_t *rng, char *why)
+{
+    int     n = (int)bench_rand64(rng);
+    char    want[16];
+    char    *got;
+    int     ok;
+
+    if (bench_rand64(rng) % 8 == 0)
+        n = bench_rand64(rng) % 2 ? INT_MIN : 0;
+    snprintf(want, sizeof(want), "%d", n);
+    if (!(got = ft_itoa(n)))
+        return (snprintf(why, WHY_SIZE, "ft_itoa(%d) returned NULL", n), 0);
+    ok = strcmp(got, want) == 0;
+    if (!ok)
+        snprintf(why, WHY_SIZE, "ft_itoa(%d) = \"%.16s\"", n, got);
+    free(got);
+    return ok;
+}
+
+static int op_atoi(uint64_t *rng, char *why)
+{
+    int     n = (int)bench_rand64(rng);
+    char    s[24];
+
+    snprintf(s, sizeof(s), " \t%+d", n);
+    if (ft_atoi(s) == n)
+        return 1;
+    snprintf(why, WHY_SIZE, "ft_atoi(\"%.40s\") != %d", s, n);
+    return 0;
+}
+
+static int op_strjoin(uint64_t *rng, char *why)
+{
+    char    a[STR_MAX];
+    char    b[STR_MAX];
+    char    *got;
+    size_t  la;
+    int     ok;
+
+    rand_string(rng, a, sizeof(a), "abcdef");
+    rand_string(rng, b, sizeof(b), "uvwxyz");
+    la = strlen(a);
+    if (!(got = ft_strjoin(a, b)))
+        return (snprintf(why, WHY_SIZE, "ft_strjoin returned NULL"), 0);
+    ok = strncmp(got, a, la) == 0 && strcmp(got + la, b) == 0;
+    if (!ok)
+        snprintf(why, WHY_SIZE, "ft_strjoin(\"%.40s\", \"%.40s\") = \"%.40s\"", a, b, got);
+    free(got);
+    return ok;
+}
+
+static int op_substr(uint64_t *rng, char *why)
+{
+    char            s[STR_MAX];
+    unsigned int    start;
+    size_t          len;
+    size_t          slen;
+    size_t          want;
+    char            *got;
+    int             ok;
+
+    rand_string(rng, s, sizeof(s), "0123456789");
+    slen = strlen(s);
+    start = bench_rand64(rng) % (slen + 4);
+    len = bench_rand64(rng) % (slen + 4);
+    want = start < slen ? slen - start : 0;
+    want = len < want ? len : want;
+    if (!(got = ft_substr(s, start, len)))
+        return (snprintf(why, WHY_SIZE, "ft_substr returned NULL"), 0);
+    ok = strlen(got) == want && strncmp(got, s + (want ? start : 0), want) == 0;
+    if (!ok)
+        snprintf(why, WHY_SIZE, "ft_substr(\"%.40s\", %u, %zu) = \"%.40s\"", s, start, len, got);
+    free(got);
+    return ok;
+}
+
+static int op_strtrim(uint64_t *rng, char *why)
+{
+    char    core[STR_MAX];
+    char    s[STR_MAX + 8];
+    char    *got;
+    int     ok;
+
+    rand_string(rng, core, sizeof(core), "abc");
+    snprintf(s, sizeof(s), "xy%szyx", core);
+    if (!(got = ft_strtrim(s, "xyz")))
+        return (snprintf(why, WHY_SIZE, "ft_strtrim returned NULL"), 0);
+    ok = strcmp(got, core) == 0;
+    if (!ok)
+        snprintf(why, WHY_SIZE, "ft_strtrim(\"%.40s\", \"xyz\") = \"%.40s\"", s, got);
+    free(got);
+    return ok;
+}
+
+static int op_strmapi(uint64_t *rng, char *why)
+{
+    char    s[STR_MAX];
+    char    *got;
+    int     ok = 1;
+
+    rand_string(rng, s, sizeof(s), "abcdefgh");
+    if (!(got = ft_strmapi(s, shift_by_index)))
+        return (snprintf(why, WHY_SIZE, "ft_strmapi returned NULL"), 0);
+    for (size_t i = 0; s[i] || got[i]; i++)
+        ok &= got[i] == (s[i] ? shift_by_index(i, s[i]) : 0);
+    if (!ok)
+        snprintf(why, WHY_SIZE, "ft_strmapi(\"%.40s\") = \"%.40s\"", s, got);
+    free(got);
+    return ok;
+}
+
+static int op_striteri(uint64_t *rng, char *why)
+{
+    char    s[STR_MAX];
+    char    copy[STR_MAX];
+    int     ok = 1;
+
+    rand_string(rng, s, sizeof(s), "abcdefgh");
+    memcpy(copy, s, sizeof(s));
+    ft_striteri(s, shift_in_place);
+    for (size_t i = 0; copy[i]; i++)
+        ok &= s[i] == shift_by_index(i, copy[i]);
+    if (!ok)
+        snprintf(why, WHY_SIZE, "ft_striteri(\"%.40s\") = \"%.40s\"", copy, s);
+    return ok;
+}
+
+static int op_strdup(uint64_t *rng, char *why)
+{
+    char    s[STR_MAX];
+    char    *got;
+    int     ok;
+
+    rand_string(rng, s, sizeof(s), "ABCDEFGHIJ");
+    if (!(got = ft_strdup(s)))
+        return (snprintf(why, WHY_SIZE, "ft_strdup returned NULL"), 0);
+    ok = strcmp(got, s) == 0;
+    if (!ok)
+        snprintf(why, WHY_SIZE, "ft_strdup(\"%.40s\") = \"%.40s\"", s, got);
+    free(got);
+    return ok;
+}
+
+static int op_strlcpy(uint64_t *rng, char *why)
+{
+    char    src[STR_MAX];
+    char    dst[STR_MAX * 2];
+    char    want[STR_MAX * 2];
+    size_t  slen;
+    size_t  size;
+    size_t  dlen;
+    size_t  got;
+    int     ok;
+
+    rand_string(rng, src, sizeof(src), "klmnop");
+    slen = strlen(src);
+    size = bench_rand64(rng) % (slen + 4);
+    memset(dst, '#', sizeof(dst));
+    memcpy(want, dst, sizeof(want));
+    if (size)
+    {
+        memcpy(want, src, slen < size ? slen : size - 1);
+        want[slen < size ? slen : size - 1] = '\0';
+    }
+    got = ft_strlcpy(dst, src, size);
+    ok = got == slen && ft_strlen(src) == slen && memcmp(dst, want, sizeof(dst)) == 0;
+    if (!ok)
+        return (snprintf(why, WHY_SIZE, "ft_strlcpy(dst, \"%.40s\", %zu) = %zu", src,
+                         size, got), 0);
+    rand_string(rng, dst, STR_MAX, "qrs");
+    dlen = strlen(dst);
+    size = bench_rand64(rng) % (dlen + slen + 4);
+    memcpy(want, dst, dlen + 1);
+    if (size > dlen + 1)
+    {
+        size_t n = slen < size - dlen - 1 ? slen : size - dlen - 1;
+
+        memcpy(want + dlen, src, n);
+        want[dlen + n] = '\0';
+    }
+    got = ft_strlcat(dst, src, size);
+    ok = got == (size < dlen ? size : dlen) + slen && strcmp(dst, want) == 0;
+    if (!ok)
+        snprintf(why, WHY_SIZE, "ft_strlcat(\"%.30s\", \"%.30s\", %zu) = %zu", want,
+                 src, size, got);
+    return ok;
+}
+
+static int op_strnstr(uint64_t *rng, char *why)
+{
+    char    hay[STR_MAX];
+    char    needle[8];
+    char    window[STR_MAX];
+    size_t  len;
+    char    *want;
+    char    *got;
+
+    rand_string(rng, hay, sizeof(hay), "ab");
+    rand_string(rng, needle, sizeof(needle), "ab");
+    len = bench_rand64(rng) % (strlen(hay) + 4);
+    snprintf(window, sizeof(window), "%.*s", (int)len, hay);
+    want = strstr(window, needle);
+    want = want ? hay + (want - window) : NULL;
+    got = ft_strnstr(hay, needle, len);
+    if (got == want)
+        return 1;
+    snprintf(why, WHY_SIZE, "ft_strnstr(\"%.40s\", \"%s\", %zu) at %td", hay, needle,
+             len, got ? got - hay : -1);
+    return 0;
+}
+
+static int op_memchr(uint64_t *rng, char *why)
+{
+    unsigned char   s[STR_MAX];
+    int             c = (int)(bench_rand64(rng) % 8) - 4;
+    size_t          n = bench_rand64(rng) % sizeof(s);
+
+    for (size_t i = 0; i < sizeof(s); i++)
+        s[i] = (unsigned char)(bench_rand64(rng) % 8 - 4);
+    if (ft_memchr(s, c, n) == memchr(s, c, n))
+        return 1;
+    snprintf(why, WHY_SIZE, "ft_memchr(s, %d, %zu) != memchr", c, n);
+    return 0;
+}
+
+static int sign(int x)
+{
+    return (x > 0) - (x < 0);
+}
+
+static int op_cmp(uint64_t *rng, char *why)
+{
+    char    a[STR_MAX];
+    char    b[STR_MAX];
+    size_t  n;
+
+    rand_string(rng, a, sizeof(a), "ab\x80\xff");
+    memcpy(b, a, sizeof(a));
+    if (bench_rand64(rng) % 2)
+        rand_string(rng, b, sizeof(b), "ab\x80\xff");
+    n = bench_rand64(rng) % (sizeof(a) + 1);
+    if (sign(ft_memcmp(a, b, n)) != sign(memcmp(a, b, n)))
+        return (snprintf(why, WHY_SIZE, "ft_memcmp(\"%.30s\", \"%.30s\", %zu)", a, b,
+                         n), 0);
+    if (sign(ft_strncmp(a, b, n)) != sign(strncmp(a, b, n)))
+        return (snprintf(why, WHY_SIZE, "ft_strncmp(\"%.30s\", \"%.30s\", %zu)", a, b,
+                         n), 0);
+    return 1;
+}
+
+static int op_strchr(uint64_t *rng, char *why)
+{
+    char    s[STR_MAX];
+    int     c = "abcd\0"[bench_rand64(rng) % 5];
+
+    rand_string(rng, s, sizeof(s), "abc");
+    if (ft_strchr(s, c) != strchr(s, c))
+        return (snprintf(why, WHY_SIZE, "ft_strchr(\"%.40s\", %d) != strchr", s, c), 0);
+    if (ft_strrchr(s, c) != strrchr(s, c))
+        return (snprintf(why, WHY_SIZE, "ft_strrchr(\"%.40s\", %d) != strrchr", s, c), 0);
+    return 1;
+}
+
+/* The block is dirtied before free, so a reused chunk shows up unzeroed */
+static int op_calloc(uint64_t *rng, char *why)
+{
+    size_t          count = 1 + bench_rand64(rng) % 32;
+    size_t          size = 1 + bench_rand64(rng) % 8;
+    unsigned char   *p = ft_calloc(count, size);
+    int             ok = 1;
+
+    if (!p)
+        return (snprintf(why, WHY_SIZE, "ft_calloc(%zu, %zu) returned NULL", count,
+                         size), 0);
+    for (size_t i = 0; i < count * size; i++)
+        ok &= p[i] == 0;
+    if (!ok)
+        snprintf(why, WHY_SIZE, "ft_calloc(%zu, %zu): not zeroed", count, size);
+    memset(p, 0xA5, count * size);
+    free(p);
+    return ok;
+}
+
+/* memset, bzero, memcpy and memmove (overlapping both ways) on one buffer,
+ * replayed with libc on a second one */
+static int op_mem(uint64_t *rng, char *why)
+{
+    unsigned char   got[STR_MAX];
+    unsigned char   want[STR_MAX];
+    size_t          n = bench_rand64(rng) % (STR_MAX / 2);
+    size_t          off = bench_rand64(rng) % (STR_MAX / 2);
+    int             c = (int)(bench_rand64(rng) % 256);
+
+    for (size_t i = 0; i < STR_MAX; i++)
+        got[i] = want[i] = (unsigned char)i;
+    if (ft_memset(got + off, c, n) != got + off)
+        return (snprintf(why, WHY_SIZE, "ft_memset: wrong return value"), 0);
+    memset(want + off, c, n);
+    ft_bzero(got + n / 2, n / 4);
+    memset(want + n / 2, 0, n / 4);
+    if (ft_memcpy(got + STR_MAX / 2, got, n) != got + STR_MAX / 2)
+        return (snprintf(why, WHY_SIZE, "ft_memcpy: wrong return value"), 0);
+    memcpy(want + STR_MAX / 2, want, n);
+    if (ft_memmove(got + off, got + n / 3, n) != got + off)
+        return (snprintf(why, WHY_SIZE, "ft_memmove: wrong return value"), 0);
+    memmove(want + off, want + n / 3, n);
+    if (memcmp(got, want, STR_MAX) == 0)
+        return 1;
+    snprintf(why, WHY_SIZE, "memset/bzero/memcpy/memmove, n %zu, offset %zu: "
+             "buffers differ", n, off);
+    return 0;
+}
+
+/* Every byte value through the ctype and case functions, against libc in
+ * the C locale; only truth matters for the is* results */
+static int op_ctype(uint64_t *rng, char *why)
+{
+    static const struct
+    {
+        const char  *name;
+        int         (*ft)(int);
+        int         (*libc)(int);
+        int         truth;
+    }   f[] = {
+        {"ft_isalpha", ft_isalpha, isalpha, 1},
+        {"ft_isdigit", ft_isdigit, isdigit, 1},
+        {"ft_isalnum", ft_isalnum, isalnum, 1},
+        {"ft_isascii", ft_isascii, isascii, 1},
+        {"ft_isprint", ft_isprint, isprint, 1},
+        {"ft_toupper", ft_toupper, toupper, 0},
+        {"ft_tolower", ft_tolower, tolower, 0},
+    };
+    size_t  k = bench_rand64(rng) % (sizeof(f) / sizeof(f[0]));
+
+    for (int c = 0; c < 256; c++)
+    {
+        int got = f[k].ft(c);
+        int want = f[k].libc(c);
+
+        if (f[k].truth ? !got == !want : got == want)
+            continue ;
+        snprintf(why, WHY_SIZE, "%s(%d) = %d, libc says %d", f[k].name, c, got, want);
+        return 0;
+    }
+    return 1;
+}
+
+/* Builds a private list, maps it, walks both and frees them */
+static int op_lists(uint64_t *rng, char *why)
+{
+    long    n = 1 + bench_rand64(rng) % LIST_MAX;
+    t_list  *lst = NULL;
+    t_list  *mapped;
+    int     ok;
+
+    for (long i = 1; i <= n; i++)
+        ft_lstadd_back(&lst, ft_lstnew((void *)(intptr_t)i));
+    mapped = ft_lstmap(lst, double_content, del_nothing);
+    g_iter_sum = 0;
+    ft_lstiter(mapped, iter_sum);
+    ok = ft_lstsize(lst) == n && ft_lstsize(mapped) == n
+        && ft_lstlast(lst)->content == (void *)(intptr_t)n
+        && g_iter_sum == n * (n + 1);
+    if (!ok)
+        snprintf(why, WHY_SIZE, "list of %ld nodes: size/last/map/iter mismatch", n);
+    ft_lstclear(&lst, del_nothing);
+    ft_lstclear(&mapped, del_nothing);
+    return ok && lst == NULL && mapped == NULL;
+}
+
+typedef struct s_op
+{
+    const char  *name;
+    t_op_fn     fn;
+}   t_op;
+
+static const t_op g_ops[] = {
+    {"ft_split", op_split},
+    {"ft_itoa", op_itoa},
+    {"ft_atoi", op_atoi},
+    {"ft_strjoin", op_strjoin},
+    {"ft_substr", op_substr},
+    {"ft_strtrim", op_strtrim},
+    {"ft_strmapi", op_strmapi},
+    {"ft_striteri", op_striteri},
+    {"ft_strdup", op_strdup},
+    {"ft_strlen/strlcpy/strlcat", op_strlcpy},
+    {"ft_strnstr", op_strnstr},
+    {"ft_memchr", op_memchr},
+    {"ft_memcmp/strncmp", op_cmp},
+    {"ft_strchr/strrchr", op_strchr},
+    {"ft_calloc", op_calloc},
+    {"ft_mem*/bzero", op_mem},
+    {"ft_is*/toupper/tolower", op_ctype},
+    {"ft_lst*", op_lists},
+};
+
+#define OP_COUNT    (sizeof(g_ops) / sizeof(g_ops[0]))
+
+/* ========== Workers ========== */
+
+typedef struct s_worker
+{
+    pthread_t       tid;
+    uint64_t        seed;
+    const int       *stop;
+    unsigned long   calls[OP_COUNT];
+    unsigned long   fails[OP_COUNT];
+    char            why[OP_COUNT][WHY_SIZE];
+}   t_worker;
+
+/* Threads start together on a barrier and interleave all ops so that
+ * different functions run at the same time, not just the same one. */
+static pthread_barrier_t g_start;
+
+static void *stress_worker(void *arg)
+{
+    t_worker    *w = arg;
+    uint64_t    rng = w->seed;
+    char        why[WHY_SIZE];
+
+    pthread_barrier_wait(&g_start);
+    while (!__atomic_load_n(w->stop, __ATOMIC_RELAXED))
+    {
+        unsigned long failed = 0;
+
+        for (size_t op = 0; op < OP_COUNT; op++)
+        {
+            w->calls[op]++;
+            if (g_ops[op].fn(&rng, why))
+                continue ;
+            failed++;
+            if (w->fails[op]++ == 0)
+                memcpy(w->why[op], why, WHY_SIZE);
+        }
+        progress_add(OP_COUNT, OP_COUNT - failed, failed);
+    }
+    return NULL;
+}
+
+/* Runs `threads` workers for `duration` seconds and folds their counters
+ * into calls/fails; returns the aggregate rate in ops per second */
+static double stress_round(int threads, double duration, unsigned long *calls,
+                           unsigned long *fails, char (*why)[WHY_SIZE])
+{
+    t_worker        *w = calloc(threads, sizeof(*w));
+    char            label[32];
+    int             stop = 0;
+    unsigned long   total = 0;
+    uint64_t        t0;
+    double          secs;
+
+    if (!w)
+        return 0;
+    pthread_barrier_init(&g_start, NULL, threads + 1);
+    for (int i = 0; i < threads; i++)
+    {
+        w[i].seed = 0x9E3779B97F4A7C15ull * (i + 1) | 1;
+        w[i].stop = &stop;
+        pthread_create(&w[i].tid, NULL, stress_worker, &w[i]);
+    }
+    snprintf(label, sizeof(label), "%d thread%s", threads, threads == 1 ? "" : "s");
+    progress_start("calls", 0, duration, 1);
+    progress_current(label);
+    pthread_barrier_wait(&g_start);
+    t0 = bench_now_ns();
+    usleep((useconds_t)(duration * 1e6));
+    __atomic_store_n(&stop, 1, __ATOMIC_RELAXED);
+    for (int i = 0; i < threads; i++)
+        pthread_join(w[i].tid, NULL);
+    secs = (bench_now_ns() - t0) / 1e9;
+    progress_stop();
+    pthread_barrier_destroy(&g_start);
+    for (int i = 0; i < threads; i++)
+    {
+        for (size_t op = 0; op < OP_COUNT; op++)
+        {
+            if (w[i].fails[op] && !fails[op])
+                memcpy(why[op], w[i].why[op], WHY_SIZE);
+            calls[op] += w[i].calls[op];
+            fails[op] += w[i].fails[op];
+            total += w[i].calls[op];
+        }
+    }
+    free(w);
+    return total / secs;
+}
+
+/* ========== Main ========== */
+
+static void usage(const char *prog)
+{
+    printf("usage: %s [--threads N] [--duration SEC]\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+    long            max_threads = sysconf(_SC_NPROCESSORS_ONLN);
+    double          duration = DEFAULT_DURATION;
+    unsigned long   calls[OP_COUNT] = {0};
+    unsigned long   fails[OP_COUNT] = {0};
+    char            why[OP_COUNT][WHY_SIZE];
+    double          base = 0;
+
+    setvbuf(stdout, NULL, _IONBF, 0);
+    /* even on one CPU two threads preempt each other mid-call */
+    if (max_threads < 2)
+        max_threads = 2;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            max_threads = atol(argv[++i]);
+        else if (strcmp(argv[i], "--duration") == 0 && i + 1 < argc)
+            duration = atof(argv[++i]);
+        else
+        {
+            usage(argv[0]);
+            return (2);
+        }
+    }
+    if (max_threads < 1)
+        max_threads = 1;
+
+    part_header("STRESS: Concurrent libft Calls");
+
+    /* 1, 2, 4, ... threads, always ending on max_threads */
+    bench_section("Throughput scaling (all functions interleaved)");
+    printf("%s%8s │ %14s %9s %11s%s\n", CLR_BOLD, "threads", "calls/s",
+           "speedup", "efficiency", CLR_RESET);
+    for (long t = 1; ; t *= 2)
+    {
+        double  rate;
+        char    key[64];
+
+        if (t > max_threads)
+            t = max_threads;
+        rate = stress_round((int)t, duration, calls, fails, why);
+        if (t == 1)
+            base = rate;
+        printf("%8ld │ %14.0f %8.2fx %10.0f%%\n", t, rate, rate / base,
+               100.0 * rate / base / t);
+        snprintf(key, sizeof(key), "stress.threads_%ld", t);
+        metric(key, rate, "calls/s");
+        if (t == max_threads)
+            break ;
+    }
+
+    bench_section("Results checked after every call");
+    for (size_t op = 0; op < OP_COUNT; op++)
+    {
+        char msg[128];
+
+        if (fails[op] == 0)
+        {
+            snprintf(msg, sizeof(msg), "%s: %lu concurrent calls", g_ops[op].name,
+                     calls[op]);
+            result_ok(msg);
+            continue ;
+        }
+        snprintf(msg, sizeof(msg), "%s: %lu of %lu calls wrong", g_ops[op].name,
+                 fails[op], calls[op]);
+        result_ko(msg);
+        printf("      %se.g. %s%s\n", CLR_RED, why[op], CLR_RESET);
+    }
+    if (max_threads == 1)
+        bench_warn("only one thread ran: pass --threads N to run calls concurrently");
+
+    summary();
+    return (tests_run == tests_passed ? 0 : 1);
+}
@@ -918,60 +918,49 @@ static void test_putnbr_fd(void)
 
 /* ========== Main Test Runner ========== */
 
-int main(void)
+static const t_test g_tests[] = {
+    PART("PART 1: Libc Functions", test_isalpha),
+    TEST(test_isdigit),
+    TEST(test_isalnum),
+    TEST(test_isascii),
+    TEST(test_isprint),
+    TEST(test_strlen),
+    TEST(test_memset),
+    TEST(test_bzero),
+    TEST(test_memcpy),
+    TEST(test_memmove),
+    TEST(test_memchr),
+    TEST(test_memcmp),
+    TEST(test_strchr),
+    TEST(test_strrchr),
+    TEST(test_strnstr),
+    TEST(test_strncmp),
+    TEST(test_strlcpy),
+    TEST(test_strlcat),
+    TEST(test_toupper),
+    TEST(test_tolower),
+    TEST(test_atoi),
+    TEST(test_calloc),
+    TEST(test_strdup),
+    PART("PART 2: Additional Functions", test_substr),
+    TEST(test_strjoin),
+    TEST(test_strtrim),
+    TEST(test_split),
+    TEST(test_itoa),
+    TEST(test_strmapi),
+    TEST(test_striteri),
+    TEST(test_putchar_fd),
+    TEST(test_putstr_fd),
+    TEST(test_putendl_fd),
+    TEST(test_putnbr_fd),
+};
+
+int main(int argc, char **argv)
 {
     setvbuf(stdout, NULL, _IONBF, 0);
     banner();
     
-    printf("\n%s%s╔════════════════════════════════════════════════╗%s\n", 
-           CLR_BOLD, CLR_CYAN, CLR_RESET);
-    printf("%s%s║    PART 1: Libc Functions                      ║%s\n", 
-           CLR_BOLD, CLR_CYAN, CLR_RESET);
-    printf("%s%s╚════════════════════════════════════════════════╝%s\n", 
-           CLR_BOLD, CLR_CYAN, CLR_RESET);
-    
-    test_isalpha();
-    test_isdigit();
-    test_isalnum();
-    test_isascii();
-    test_isprint();
-    test_strlen();
-    test_memset();
-    test_bzero();
-    test_memcpy();
-    test_memmove();
-    test_memchr();
-    test_memcmp();
-    test_strchr();
-    test_strrchr();
-    test_strnstr();
-    test_strncmp();
-    test_strlcpy();
-    test_strlcat();
-    test_toupper();
-    test_tolower();
-    test_atoi();
-    test_calloc();
-    test_strdup();
-    
-    printf("\n%s%s╔════════════════════════════════════════════════╗%s\n", 
-           CLR_BOLD, CLR_CYAN, CLR_RESET);
-    printf("%s%s║    PART 2: Additional Functions                ║%s\n", 
-           CLR_BOLD, CLR_CYAN, CLR_RESET);
-    printf("%s%s╚════════════════════════════════════════════════╝%s\n", 
-           CLR_BOLD, CLR_CYAN, CLR_RESET);
-    
-    test_substr();
-    test_strjoin();
-    test_strtrim();
-    test_split();
-    test_itoa();
-    test_strmapi();
-    test_striteri();
-    test_putchar_fd();
-    test_putstr_fd();
-    test_putendl_fd();
-    test_putnbr_fd();
+    run_tests(g_tests, TEST_COUNT(g_tests), argc, argv);
     
     summary();
     
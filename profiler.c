@@ -0,0 +1,303 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   profiler.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include "alloc_hooks.h"
+#include "profiler.h"
+
+#define DEFAULT_HZ      997
+#define PROF_FRAMES     64
+#define PROF_SAMPLES    (1 << 15)
+#define PROF_TOP        3
+#define NAME_MAX_LEN    128
+
+/* backtrace() from the handler starts with the handler itself and the
+ * signal trampoline; the interrupted instruction comes next */
+#define HANDLER_FRAMES  2
+
+typedef struct s_sample
+{
+    int     depth;
+    void    *pc[PROF_FRAMES];
+}   t_sample;
+
+typedef struct s_profiler
+{
+    char            *path;
+    char            *only;
+    int             hz;
+    t_sample        *samples;
+    unsigned long   n;
+    unsigned long   dropped;
+    volatile int    active;
+    const char      *tag;
+    int             outer;
+}   t_profiler;
+
+static t_profiler   g_prof;
+
+/* ========== Symbols ========== */
+
+/* A frame's function, "[libc.so.6]" when only its object is known */
+static void name_of(void *pc, char *buf, size_t size)
+{
+    const char  *name = alloc_symbol(pc, NULL);
+    Dl_info     info = {0};
+
+    if (name)
+        snprintf(buf, size, "%s", name);
+    else if (dladdr(pc, &info) && info.dli_fname && *info.dli_fname)
+        snprintf(buf, size, "[%s]", strrchr(info.dli_fname, '/')
+                 ? strrchr(info.dli_fname, '/') + 1 : info.dli_fname);
+    else
+        snprintf(buf, size, "[unknown]");
+}
+
+/* ========== Sampling ========== */
+
+/* Allocations tracked for leak reports unwind with backtrace() too; a
+ * sample landing in there is counted but not unwound a second time */
+static void on_prof(int sig)
+{
+    unsigned long   i;
+
+    (void)sig;
+    if (!g_prof.active)
+        return ;
+    i = __atomic_fetch_add(&g_prof.n, 1, __ATOMIC_RELAXED);
+    if (i >= PROF_SAMPLES)
+    {
+        __atomic_fetch_add(&g_prof.dropped, 1, __ATOMIC_RELAXED);
+        return ;
+    }
+    if (alloc_track_unwinding())
+        g_prof.samples[i].depth = -1;
+    else
+        g_prof.samples[i].depth = backtrace(g_prof.samples[i].pc, PROF_FRAMES);
+}
+
+void prof_open(const char *path, int hz, const char *only)
+{
+    void    *prime[1];
+    int     fd;
+
+    if ((fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644)) < 0)
+    {
+        perror(path);
+        return ;
+    }
+    close(fd);
+    g_prof.samples = mmap(NULL, PROF_SAMPLES * sizeof(t_sample),
+                          PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (g_prof.samples == MAP_FAILED)
+    {
+        g_prof.samples = NULL;
+        perror("monsters: profiler");
+        return ;
+    }
+    g_prof.path = strdup(path);
+    g_prof.only = only && *only ? strdup(only) : NULL;
+    g_prof.hz = hz > 0 ? hz : DEFAULT_HZ;
+    /* the first backtrace() loads libgcc_s, which must not happen in
+     * the signal handler */
+    backtrace(prime, 1);
+}
+
+/* No allocation here: prof_begin() runs inside measured code */
+int prof_enabled(const char *tag)
+{
+    const char  *p;
+    size_t      len;
+
+    if (!g_prof.path)
+        return 0;
+    if (!g_prof.only)
+        return 1;
+    for (p = g_prof.only; *p; p += len + (p[len] == ','))
+    {
+        len = strcspn(p, ",");
+        for (const char *t = tag; len && *t; t++)
+            if (strncmp(t, p, len) == 0)
+                return 1;
+    }
+    return 0;
+}
+
+static void arm(int hz)
+{
+    struct itimerval    it = {{0, hz ? 1000000 / hz : 0}, {0, hz ? 1000000 / hz : 0}};
+    struct sigaction    sa;
+
+    if (hz)
+    {
+        memset(&sa, 0, sizeof(sa));
+        sa.sa_handler = on_prof;
+        sa.sa_flags = SA_RESTART;
+        sigemptyset(&sa.sa_mask);
+        sigaction(SIGPROF, &sa, NULL);
+    }
+    setitimer(ITIMER_PROF, &it, NULL);
+}
+
+void prof_begin(const char *tag)
+{
+    void    *frames[PROF_FRAMES];
+
+    if (g_prof.active || !prof_enabled(tag))
+        return ;
+    /* everything outside this frame is in every sample: cut it off */
+    g_prof.outer = backtrace(frames, PROF_FRAMES) - 1;
+    g_prof.tag = tag;
+    g_prof.n = 0;
+    g_prof.dropped = 0;
+    g_prof.active = 1;
+    arm(g_prof.hz);
+}
+
+/* ========== Folding ========== */
+
+typedef struct s_stack
+{
+    char            *line;
+    unsigned long   count;
+}   t_stack;
+
+static int by_line(const void *a, const void *b)
+{
+    return strcmp(((const t_stack *)a)->line, ((const t_stack *)b)->line);
+}
+
+/* "outer;...;leaf" for one sample, NULL when it has no own frame */
+static char *fold(const t_sample *s)
+{
+    char    name[NAME_MAX_LEN];
+    char    *line;
+    size_t  cap;
+    size_t  len = 0;
+    int     last = s->depth;
+
+    if (s->depth < 0)
+        return strdup("[leak tracking]");
+    if (s->depth < PROF_FRAMES)
+        last = s->depth - g_prof.outer;
+    cap = (size_t)(last + 1) * (NAME_MAX_LEN + 1);
+    if (last <= HANDLER_FRAMES || !(line = malloc(cap)))
+        return NULL;
+    line[0] = '\0';
+    if (s->depth >= PROF_FRAMES)
+        len = (size_t)snprintf(line, cap, "[truncated]");
+    for (int i = last - 1; i >= HANDLER_FRAMES; i--)
+    {
+        /* return addresses point after the call, maybe into the next
+         * function; the interrupted pc itself is exact */
+        name_of((char *)s->pc[i] - (i > HANDLER_FRAMES), name, sizeof(name));
+        len += (size_t)snprintf(line + len, cap - len, "%s%s", len ? ";" : "", name);
+    }
+    return line;
+}
+
+/* Prints the PROF_TOP functions with the most self time (leaf frames) */
+static void print_top(const t_stack *stacks, size_t n, unsigned long total)
+{
+    t_stack top[PROF_TOP + 1];
+    size_t  ntop = 0;
+    t_stack *leaves = calloc(n, sizeof(*leaves));
+    size_t  nleaves = 0;
+
+    if (!leaves)
+        return ;
+    for (size_t i = 0; i < n; i++)
+    {
+        const char  *leaf = strrchr(stacks[i].line, ';');
+        size_t      k = 0;
+
+        leaf = leaf ? leaf + 1 : stacks[i].line;
+        while (k < nleaves && strcmp(leaves[k].line, leaf) != 0)
+            k++;
+        if (k == nleaves)
+            leaves[nleaves++] = (t_stack){(char *)leaf, 0};
+        leaves[k].count += stacks[i].count;
+    }
+    for (size_t i = 0; i < nleaves; i++)
+    {
+        size_t k = ntop;
+
+        while (k > 0 && leaves[i].count > top[k - 1].count)
+        {
+            top[k] = top[k - 1];
+            k--;
+        }
+        top[k] = leaves[i];
+        ntop += ntop < PROF_TOP;
+    }
+    printf("\x1b[35m  🔥 %s: %lu samples", g_prof.tag, total);
+    for (size_t i = 0; i < ntop; i++)
+        printf("%s %s %.0f%%", i ? "," : "", top[i].line, 100.0 * top[i].count / total);
+    printf("\x1b[0m\n");
+    free(leaves);
+}
+
+void prof_end(void)
+{
+    unsigned long   n = g_prof.n < PROF_SAMPLES ? g_prof.n : PROF_SAMPLES;
+    t_stack         *stacks;
+    size_t          count = 0;
+    size_t          k = 0;
+    unsigned long   total = 0;
+    FILE            *out;
+
+    if (!g_prof.active)
+        return ;
+    arm(0);
+    g_prof.active = 0;
+    if (!n || !(stacks = calloc(n, sizeof(*stacks))))
+        return ;
+    for (unsigned long i = 0; i < n; i++)
+        if ((stacks[count].line = fold(&g_prof.samples[i])))
+            stacks[count++].count = 1;
+    qsort(stacks, count, sizeof(*stacks), by_line);
+    for (size_t i = 0; i < count; i++)
+    {
+        total += stacks[i].count;
+        if (k && strcmp(stacks[k - 1].line, stacks[i].line) == 0)
+        {
+            stacks[k - 1].count += stacks[i].count;
+            free(stacks[i].line);
+        }
+        else
+            stacks[k++] = stacks[i];
+    }
+    if (k && (out = fopen(g_prof.path, "a")))
+    {
+        for (size_t i = 0; i < k; i++)
+            fprintf(out, "%s;%s %lu\n", g_prof.tag, stacks[i].line, stacks[i].count);
+        fclose(out);
+    }
+    if (total)
+        print_top(stacks, k, total);
+    if (g_prof.dropped)
+        printf("\x1b[33m  ⚠ %s: %lu samples dropped, buffer full\x1b[0m\n",
+               g_prof.tag, g_prof.dropped);
+    for (size_t i = 0; i < k; i++)
+        free(stacks[i].line);
+    free(stacks);
+}
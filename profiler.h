@@ -0,0 +1,35 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   profiler.h                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PROFILER_H
+# define PROFILER_H
+
+/* 🔥 Sampling profiler. Between prof_begin(tag) and prof_end(), SIGPROF
+ *    fires every 1/hz s of CPU time and the handler saves the call stack
+ *    with backtrace(). prof_end() appends the stacks to the folded file
+ *    as "tag;outer;...;leaf count" lines, the format flamegraph.pl and
+ *    speedscope read, and prints the functions with the most self time.
+ *    Frames from main() down to the caller of prof_begin() are the same
+ *    in every sample and are cut off. Static functions of the executable
+ *    are named from its own symbol table, the rest through dladdr(). */
+
+/* Truncates path and arms nothing yet. only: comma-separated substrings,
+ * a tag is profiled when it contains one of them (NULL: every tag). */
+void    prof_open(const char *path, int hz, const char *only);
+int     prof_enabled(const char *tag);
+
+/* Samples belong to tag until prof_end(); both are no-ops when tag is not
+ * enabled. Works in forked children: settings are inherited, the timer is
+ * armed by whichever process calls prof_begin(). */
+void    prof_begin(const char *tag);
+void    prof_end(void);
+
+#endif
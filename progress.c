@@ -0,0 +1,247 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   progress.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "progress.h"
+
+#define DEFAULT_INTERVAL    1.0
+
+typedef struct s_progress
+{
+    pthread_t       ticker;
+    pthread_mutex_t lock;
+    pthread_cond_t  wake;
+    int             running;
+    int             stop;
+    int             live;
+    int             held;
+    FILE            *json;
+    const char      *unit;
+    const char      *current;
+    double          total;
+    double          duration;
+    double          interval;
+    double          started;
+    double          last_t;
+    unsigned long   last_done;
+    unsigned long   done;
+    unsigned long   passed;
+    unsigned long   failed;
+    double          rate;
+    double          eta;
+}   t_progress;
+
+static t_progress g_progress = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .wake = PTHREAD_COND_INITIALIZER,
+};
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* ========== Rendering ========== */
+
+/* Seconds left: from the planned duration if there is one, else from
+ * the average rate so far; negative when unknown */
+static double eta_of(const t_progress *p, unsigned long done, double elapsed,
+                     double avg_rate)
+{
+    if (p->duration > 0)
+        return elapsed < p->duration ? p->duration - elapsed : 0;
+    if (p->total > 0 && avg_rate > 0)
+        return done < p->total ? (p->total - done) / avg_rate : 0;
+    return -1;
+}
+
+static void fmt_duration(char *buf, size_t size, double secs)
+{
+    long s = (long)(secs + 0.5);
+
+    if (secs < 0)
+        snprintf(buf, size, "?");
+    else
+        snprintf(buf, size, "%ld:%02ld:%02ld", s / 3600, s / 60 % 60, s % 60);
+}
+
+/* Caller holds the lock; uses the rate and ETA of the last tick */
+static void draw(const t_progress *p)
+{
+    unsigned long   done = __atomic_load_n(&p->done, __ATOMIC_RELAXED);
+    const char      *current = __atomic_load_n(&p->current, __ATOMIC_RELAXED);
+    char            eta_s[32];
+    char            total_s[32] = "";
+
+    if (!p->live || p->held)
+        return ;
+    if (p->total > 0)
+        snprintf(total_s, sizeof(total_s), "/%.0f", p->total);
+    fmt_duration(eta_s, sizeof(eta_s), p->eta);
+    fprintf(stderr, "\r\x1b[K⏳ %s │ %lu%s %s │ %.0f %s/s │ ✓ %lu ✗ %lu │ ETA %s",
+            current ? current : "-", done, total_s, p->unit, p->rate, p->unit,
+            __atomic_load_n(&p->passed, __ATOMIC_RELAXED),
+            __atomic_load_n(&p->failed, __ATOMIC_RELAXED), eta_s);
+}
+
+static void tick(t_progress *p, double t)
+{
+    unsigned long   done = __atomic_load_n(&p->done, __ATOMIC_RELAXED);
+    unsigned long   passed = __atomic_load_n(&p->passed, __ATOMIC_RELAXED);
+    unsigned long   failed = __atomic_load_n(&p->failed, __ATOMIC_RELAXED);
+    const char      *current = __atomic_load_n(&p->current, __ATOMIC_RELAXED);
+    double          elapsed = t - p->started;
+    double          rate = t > p->last_t ? (done - p->last_done) / (t - p->last_t) : 0;
+    double          avg = elapsed > 0 ? done / elapsed : 0;
+    double          eta = eta_of(p, done, elapsed, avg);
+
+    p->last_t = t;
+    p->last_done = done;
+    p->rate = rate;
+    p->eta = eta;
+    draw(p);
+    if (p->json)
+    {
+        fprintf(p->json, "{\"elapsed_s\":%.3f,\"current\":\"%s\",\"unit\":\"%s\","
+                "\"done\":%lu,\"total\":%.0f,\"passed\":%lu,\"failed\":%lu,"
+                "\"rate\":%.1f,\"avg_rate\":%.1f,\"eta_s\":%.1f}\n",
+                elapsed, current ? current : "", p->unit, done, p->total,
+                passed, failed, rate, avg, eta);
+        fflush(p->json);
+    }
+}
+
+static void *ticker(void *arg)
+{
+    t_progress      *p = arg;
+    struct timespec deadline;
+
+    pthread_mutex_lock(&p->lock);
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    while (!p->stop)
+    {
+        deadline.tv_sec += (time_t)p->interval;
+        deadline.tv_nsec += (long)((p->interval - (time_t)p->interval) * 1e9);
+        if (deadline.tv_nsec >= 1000000000L)
+        {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+        while (!p->stop && pthread_cond_timedwait(&p->wake, &p->lock, &deadline) == 0)
+            ;
+        if (!p->stop)
+            tick(p, now_s());
+    }
+    pthread_mutex_unlock(&p->lock);
+    return NULL;
+}
+
+/* ========== Public API ========== */
+
+void progress_start(const char *unit, double total, double duration, int live)
+{
+    t_progress  *p = &g_progress;
+    const char  *path = getenv("MONSTERS_PROGRESS");
+    const char  *interval = getenv("MONSTERS_PROGRESS_INTERVAL");
+
+    if (p->running)
+        progress_stop();
+    p->live = live && isatty(STDERR_FILENO);
+    p->json = path && *path ? fopen(path, "a") : NULL;
+    if (!p->live && !p->json)
+        return ;
+    p->unit = unit;
+    p->current = NULL;
+    p->total = total;
+    p->duration = duration;
+    p->interval = interval ? atof(interval) : DEFAULT_INTERVAL;
+    if (p->interval <= 0)
+        p->interval = DEFAULT_INTERVAL;
+    p->started = now_s();
+    p->last_t = p->started;
+    p->last_done = 0;
+    p->done = 0;
+    p->passed = 0;
+    p->failed = 0;
+    p->rate = 0;
+    p->eta = -1;
+    p->held = 0;
+    p->stop = 0;
+    if (pthread_create(&p->ticker, NULL, ticker, p) == 0)
+        p->running = 1;
+}
+
+void progress_current(const char *name)
+{
+    __atomic_store_n(&g_progress.current, name, __ATOMIC_RELAXED);
+}
+
+void progress_add(unsigned long done, unsigned long passed, unsigned long failed)
+{
+    __atomic_add_fetch(&g_progress.done, done, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&g_progress.passed, passed, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&g_progress.failed, failed, __ATOMIC_RELAXED);
+}
+
+void progress_hold(void)
+{
+    t_progress *p = &g_progress;
+
+    pthread_mutex_lock(&p->lock);
+    if (p->live && !p->held)
+        fprintf(stderr, "\r\x1b[K");
+    p->held = 1;
+    pthread_mutex_unlock(&p->lock);
+}
+
+void progress_release(void)
+{
+    t_progress *p = &g_progress;
+
+    fflush(stdout);
+    pthread_mutex_lock(&p->lock);
+    p->held = 0;
+    draw(p);
+    pthread_mutex_unlock(&p->lock);
+}
+
+void progress_stop(void)
+{
+    t_progress *p = &g_progress;
+
+    if (!p->running)
+    {
+        if (p->json)
+            fclose(p->json);
+        p->json = NULL;
+        return ;
+    }
+    pthread_mutex_lock(&p->lock);
+    p->stop = 1;
+    pthread_cond_signal(&p->wake);
+    pthread_mutex_unlock(&p->lock);
+    pthread_join(p->ticker, NULL);
+    p->running = 0;
+    if (p->live)
+        fprintf(stderr, "\r\x1b[K");
+    p->live = 0;
+    tick(p, now_s());
+    if (p->json)
+        fclose(p->json);
+    p->json = NULL;
+}
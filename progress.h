@@ -0,0 +1,37 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   progress.h                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PROGRESS_H
+# define PROGRESS_H
+
+/* 📡 Live progress for long runs. While started, a ticker thread wakes up
+ *    every $MONSTERS_PROGRESS_INTERVAL seconds (default 1) and
+ *      - redraws one status line on stderr, if stderr is a TTY and the
+ *        line was requested (progress_start(..., live = 1));
+ *      - appends a JSON snapshot line to $MONSTERS_PROGRESS, if set.
+ *    Counters are atomic, so worker threads may call progress_add(). */
+
+/* total: units expected (0 = unknown); duration: seconds the phase is
+ * planned to last (0 = until done). Either one gives the ETA. */
+void    progress_start(const char *unit, double total, double duration, int live);
+void    progress_current(const char *name);
+void    progress_add(unsigned long done, unsigned long passed, unsigned long failed);
+
+/* Output on the terminal between hold and release is not torn by the
+ * status line: hold erases it and keeps the ticker from drawing it,
+ * release flushes stdout and draws it again under that output. */
+void    progress_hold(void);
+void    progress_release(void);
+
+/* Stops the ticker, writes a last snapshot and clears the status line */
+void    progress_stop(void);
+
+#endif
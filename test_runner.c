@@ -0,0 +1,1209 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_runner.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: yhachimi <yhachimi@student.1337.ma>        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19                                    */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <poll.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <dlfcn.h>
+#include <sys/time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/auxv.h>
+#include "test_utils.h"
+#include "alloc_hooks.h"
+#include "progress.h"
+#include "profiler.h"
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+# include <malloc.h>
+# define HAVE_MALLINFO2 1
+#endif
+
+#define MAX_LEAK_SITES      16
+#define MAX_OVERRIDES       32
+#define DEFAULT_TIMEOUT     10.0
+#define SOAK_WARMUP         2
+#define SOAK_SAMPLES        4096
+#define SOAK_MIN_SAMPLES    8
+
+/* ========== Options ========== */
+
+typedef struct s_runner
+{
+    double      timeout;
+    int         fork;
+    int         leaks;
+    double      soak;
+    int         shuffle;
+    uint64_t    seed;
+    int         fork_server;
+    int         startup;
+    const char  *profile;
+    const char  *profile_only;
+    int         profile_hz;
+    const char  *overrides[MAX_OVERRIDES];
+    int         n_overrides;
+}   t_runner;
+
+static void usage(const char *prog)
+{
+    printf("usage: %s [options]\n"
+           "  --timeout SEC        time budget per test (default %.0f s,\n"
+           "                       or $MONSTERS_TIMEOUT)\n"
+           "  --timeout NAME=SEC   budget for one test, e.g. test_split=2\n"
+           "  --no-fork            run tests in-process (for gdb); an overrun\n"
+           "                       then aborts the whole run\n"
+           "  --shuffle            run the tests in a random order, all in one\n"
+           "                       process, and bisect failures that depend on it\n"
+           "  --seed N             seed for --shuffle (implies it; default: random)\n"
+           "  --soak DURATION      after the normal run, loop the suite in-process\n"
+           "                       for DURATION (e.g. 90, 30s, 10m, 2h) and fail on\n"
+           "                       steady RSS, fd or heap growth\n"
+           "  --fork-server        serve mutants to monsters_mutate on stdin/stdout\n"
+           "  --startup N          time N launches of this binary from exec to the\n"
+           "                       end of its first test, then exit\n"
+           "  --profile FILE       sample each test's call stacks into FILE as\n"
+           "                       folded stacks (flamegraph.pl, speedscope)\n"
+           "  --profile-only LIST  profile only tests whose name contains one of\n"
+           "                       the comma-separated LIST, e.g. split,strjoin\n"
+           "  --profile-hz N       samples per CPU second (default 997)\n",
+           prog, DEFAULT_TIMEOUT);
+}
+
+/* "90" and "90s" are seconds; "10m", "2h" and "1d" scale accordingly */
+static double parse_duration(const char *s)
+{
+    char    *end;
+    double  v = strtod(s, &end);
+
+    if (*end == 'm')
+        v *= 60;
+    else if (*end == 'h')
+        v *= 3600;
+    else if (*end == 'd')
+        v *= 86400;
+    return v;
+}
+
+static void parse_args(t_runner *r, int argc, char **argv)
+{
+    const char *env = getenv("MONSTERS_TIMEOUT");
+
+    r->timeout = env ? atof(env) : DEFAULT_TIMEOUT;
+    r->fork = 1;
+    env = getenv("MONSTERS_LEAKS");
+    r->leaks = !env || strcmp(env, "0") != 0;
+    r->soak = 0;
+    r->shuffle = 0;
+    r->fork_server = 0;
+    r->startup = 0;
+    r->profile = NULL;
+    r->profile_only = NULL;
+    r->profile_hz = 0;
+    r->seed = (uint64_t)time(NULL) ^ ((uint64_t)getpid() << 32);
+    r->n_overrides = 0;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--timeout") == 0 && i + 1 < argc)
+        {
+            if (strchr(argv[++i], '=') && r->n_overrides < MAX_OVERRIDES)
+                r->overrides[r->n_overrides++] = argv[i];
+            else
+                r->timeout = atof(argv[i]);
+        }
+        else if (strcmp(argv[i], "--no-fork") == 0)
+            r->fork = 0;
+        else if (strcmp(argv[i], "--shuffle") == 0)
+            r->shuffle = 1;
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+        {
+            r->seed = strtoull(argv[++i], NULL, 0);
+            r->shuffle = 1;
+        }
+        else if (strcmp(argv[i], "--soak") == 0 && i + 1 < argc)
+            r->soak = parse_duration(argv[++i]);
+        else if (strcmp(argv[i], "--fork-server") == 0)
+            r->fork_server = 1;
+        else if (strcmp(argv[i], "--startup") == 0 && i + 1 < argc)
+            r->startup = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--profile") == 0 && i + 1 < argc)
+            r->profile = argv[++i];
+        else if (strcmp(argv[i], "--profile-only") == 0 && i + 1 < argc)
+            r->profile_only = argv[++i];
+        else if (strcmp(argv[i], "--profile-hz") == 0 && i + 1 < argc)
+            r->profile_hz = atoi(argv[++i]);
+        else
+        {
+            usage(argv[0]);
+            exit(2);
+        }
+    }
+    if (r->profile)
+        prof_open(r->profile, r->profile_hz, r->profile_only);
+}
+
+static double budget_of(const t_runner *r, const char *name)
+{
+    size_t len = strlen(name);
+
+    for (int i = r->n_overrides - 1; i >= 0; i--)
+    {
+        if (strncmp(r->overrides[i], name, len) == 0 && r->overrides[i][len] == '=')
+            return atof(r->overrides[i] + len + 1);
+    }
+    return r->timeout;
+}
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* ========== Leak Tracking ========== */
+
+static void report_leaks(const char *test)
+{
+    t_leak  leaks[MAX_LEAK_SITES];
+    size_t  n = alloc_track_stop(leaks, MAX_LEAK_SITES);
+    char    msg[256];
+
+    for (size_t i = 0; i < n; i++)
+    {
+        snprintf(msg, sizeof(msg), "leak: %zu bytes in %zu block%s from %s (%s)",
+                 leaks[i].bytes, leaks[i].blocks, leaks[i].blocks == 1 ? "" : "s",
+                 alloc_site_name(leaks[i].site), test);
+        result_ko(msg);
+    }
+}
+
+static void run_one(const t_runner *r, const t_test *test, int tag)
+{
+    if (r->leaks)
+        alloc_track_start(tag);
+    prof_begin(test->name);
+    test->fn();
+    prof_end();
+    if (r->leaks)
+        report_leaks(test->name);
+}
+
+/* ========== Watchdog ========== */
+
+/* How the last test that did not pass went wrong, for the fork server */
+static const char   *g_how = "fail";
+
+static void report_timeout(const char *name, double elapsed)
+{
+    printf("%s  ⏱ TIMEOUT %s after %.2f s%s\n", CLR_MAG, name, elapsed, CLR_RESET);
+    tests_run++;
+    g_how = "timeout";
+}
+
+static void report_crash(const char *name, int sig)
+{
+    printf("%s  💥 CRASH %s (%s)%s\n", CLR_RED, name, strsignal(sig), CLR_RESET);
+    tests_run++;
+    g_how = "crash";
+}
+
+/* Each test runs in its own child; the parent waits for the child's
+ * counters on a pipe for at most the test's budget, then kills it. */
+typedef struct s_counts
+{
+    int run;
+    int passed;
+}   t_counts;
+
+/* Returns how many bytes of *counts arrived before start + budget */
+static size_t read_counts(int fd, double start, double budget, t_counts *counts)
+{
+    size_t got = 0;
+
+    while (got < sizeof(*counts))
+    {
+        double          left = start + budget - now_s();
+        struct pollfd   pfd = {fd, POLLIN, 0};
+        int             ready;
+        ssize_t         n;
+
+        if (left <= 0)
+            break ;
+        ready = poll(&pfd, 1, (int)(left * 1000) + 1);
+        if (ready < 0 && errno == EINTR)
+            continue ;
+        if (ready <= 0)
+            break ;
+        n = read(fd, (char *)counts + got, sizeof(*counts) - got);
+        if (n <= 0)
+            break ;
+        got += n;
+    }
+    return got;
+}
+
+static void run_forked(const t_runner *r, const t_test *test, int tag)
+{
+    double      budget = budget_of(r, test->name);
+    double      start = now_s();
+    t_counts    counts = {0, 0};
+    size_t      got;
+    int         fds[2];
+    int         status;
+    pid_t       pid;
+
+    if (pipe(fds) < 0 || (pid = fork()) < 0)
+    {
+        perror("monsters: fork");
+        exit(1);
+    }
+    if (pid == 0)
+    {
+        close(fds[0]);
+        tests_run = 0;
+        tests_passed = 0;
+        run_one(r, test, tag);
+        counts = (t_counts){tests_run, tests_passed};
+        _exit(write(fds[1], &counts, sizeof(counts)) == sizeof(counts) ? 0 : 1);
+    }
+    close(fds[1]);
+    got = read_counts(fds[0], start, budget, &counts);
+    close(fds[0]);
+    if (got < sizeof(counts) && now_s() - start >= budget)
+    {
+        kill(pid, SIGKILL);
+        waitpid(pid, &status, 0);
+        report_timeout(test->name, now_s() - start);
+        return ;
+    }
+    waitpid(pid, &status, 0);
+    tests_run += counts.run;
+    tests_passed += counts.passed;
+    if (WIFSIGNALED(status))
+        report_crash(test->name, WTERMSIG(status));
+    else if (got < sizeof(counts))
+        result_ko(test->name);
+}
+
+/* --no-fork: an in-process alarm is the only way to stop a stuck test,
+ * and nothing can safely resume after it, so the run ends there.
+ * g_out is where the report goes while a soak has stdout silenced. */
+static const char   *g_current;
+static double       g_started;
+static int          g_out = STDOUT_FILENO;
+
+static void on_alarm(int sig)
+{
+    char    msg[256];
+    int     len;
+
+    (void)sig;
+    len = snprintf(msg, sizeof(msg), "%s  ⏱ TIMEOUT %s after %.2f s%s\n",
+                   CLR_MAG, g_current, now_s() - g_started, CLR_RESET);
+    write(g_out, msg, len);
+    _exit(124);
+}
+
+/* Arms the alarm for `seconds` on behalf of `name`; 0 disarms it */
+static void arm_alarm(const char *name, double seconds)
+{
+    struct itimerval it = {{0, 0}, {(time_t)seconds,
+                           (suseconds_t)((seconds - (time_t)seconds) * 1e6)}};
+
+    g_current = name;
+    g_started = now_s();
+    signal(SIGALRM, on_alarm);
+    setitimer(ITIMER_REAL, &it, NULL);
+}
+
+static void run_in_process(const t_runner *r, const t_test *test, int tag)
+{
+    arm_alarm(test->name, budget_of(r, test->name));
+    run_one(r, test, tag);
+    arm_alarm(test->name, 0);
+}
+
+/* ========== Shuffled Order ========== */
+
+/* --shuffle: forked tests never see each other's leftovers, so here the
+ * whole shuffled sequence shares one child instead. The parent still
+ * holds every test to its budget; after a crash or a timeout a fresh
+ * child carries on with the next test. */
+static uint64_t next_rand(uint64_t *state)
+{
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+static t_test *shuffle(const t_test *tests, size_t count, uint64_t seed)
+{
+    t_test      *order = malloc(count * sizeof(*order));
+    uint64_t    state = seed;
+
+    if (!order)
+    {
+        perror("monsters: shuffle");
+        exit(1);
+    }
+    memcpy(order, tests, count * sizeof(*order));
+    for (size_t i = count; i > 1; i--)
+    {
+        size_t  j = next_rand(&state) % i;
+        t_test  tmp = order[i - 1];
+
+        order[i - 1] = order[j];
+        order[j] = tmp;
+    }
+    for (size_t i = 0; i < count; i++)
+        order[i].part = NULL;
+    return order;
+}
+
+static pid_t start_chain(const t_runner *r, const t_test *tests, size_t from,
+                         size_t count, int *fd)
+{
+    int     fds[2];
+    pid_t   pid;
+
+    if (pipe(fds) < 0 || (pid = fork()) < 0)
+    {
+        perror("monsters: fork");
+        exit(1);
+    }
+    if (pid == 0)
+    {
+        close(fds[0]);
+        for (size_t i = from; i < count; i++)
+        {
+            t_counts counts;
+
+            tests_run = 0;
+            tests_passed = 0;
+            run_one(r, &tests[i], (int)i + 1);
+            counts = (t_counts){tests_run, tests_passed};
+            if (write(fds[1], &counts, sizeof(counts)) != sizeof(counts))
+                _exit(1);
+        }
+        _exit(0);
+    }
+    close(fds[1]);
+    *fd = fds[0];
+    return pid;
+}
+
+/* For bisect(): failed[i] is set for every test that did not pass, and
+ * since[i] is the first test run by the same child as tests[i] */
+static void run_chain(const t_runner *r, const t_test *tests, size_t count,
+                      char *failed, size_t *since)
+{
+    size_t  first = 0;
+
+    pid_t   pid = 0;
+    int     fd = -1;
+    int     status;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        double      budget = budget_of(r, tests[i].name);
+        double      start = now_s();
+        t_counts    counts = {0, 0};
+        int         run = tests_run;
+        int         passed = tests_passed;
+
+        if (!pid)
+        {
+            pid = start_chain(r, tests, i, count, &fd);
+            first = i;
+        }
+        since[i] = first;
+        progress_current(tests[i].name);
+        if (read_counts(fd, start, budget, &counts) == sizeof(counts))
+        {
+            tests_run += counts.run;
+            tests_passed += counts.passed;
+        }
+        else
+        {
+            int timed_out = now_s() - start >= budget;
+
+            if (timed_out)
+                kill(pid, SIGKILL);
+            waitpid(pid, &status, 0);
+            close(fd);
+            pid = 0;
+            if (timed_out)
+                report_timeout(tests[i].name, now_s() - start);
+            else if (WIFSIGNALED(status))
+                report_crash(tests[i].name, WTERMSIG(status));
+            else
+                result_ko(tests[i].name);
+        }
+        failed[i] = tests_run - run != tests_passed - passed;
+        progress_add(1, tests_passed - passed, (tests_run - run) - (tests_passed - passed));
+    }
+    if (pid)
+    {
+        close(fd);
+        waitpid(pid, &status, 0);
+    }
+}
+
+/* Runs tests[seq[0]], ..., tests[seq[n - 1]] in one fresh child with the
+ * output thrown away; true if the last one fails, crashes or hangs */
+static int chain_fails(const t_runner *r, const t_test *tests,
+                       const size_t *seq, size_t n)
+{
+    pid_t   pid = fork();
+    int     status;
+
+    if (pid < 0)
+    {
+        perror("monsters: fork");
+        exit(1);
+    }
+    if (pid == 0)
+    {
+        int     null = open("/dev/null", O_WRONLY);
+        double  budget = 0;
+        int     before;
+
+        if (null >= 0)
+            dup2(null, STDOUT_FILENO);
+        for (size_t i = 0; i < n; i++)
+            budget += budget_of(r, tests[seq[i]].name);
+        arm_alarm(tests[seq[n - 1]].name, budget);
+        for (size_t i = 0; i + 1 < n; i++)
+            run_one(r, &tests[seq[i]], (int)seq[i] + 1);
+        before = tests_run - tests_passed;
+        run_one(r, &tests[seq[n - 1]], (int)seq[n - 1] + 1);
+        _exit(tests_run - tests_passed != before);
+    }
+    waitpid(pid, &status, 0);
+    return !WIFEXITED(status) || WEXITSTATUS(status) != 0;
+}
+
+static void print_sequence(const t_test *tests, const size_t *seq, size_t n,
+                           int runs)
+{
+    printf("%s  ↳ ", CLR_RED);
+    for (size_t i = 0; i < n; i++)
+        printf("%s%s", tests[seq[i]].name, i + 1 < n ? " → " : "");
+    printf("  (%d run%s)%s\n", runs, runs == 1 ? "" : "s", CLR_RESET);
+}
+
+/* tests[k] failed after tests[0..k-1]. If it passes on its own, narrow
+ * the tests before it down: first the latest start s such that
+ * tests[s..k-1] still break it (by bisection), then drop every other
+ * test that is not needed. Each step is one forked chain_fails() run. */
+static void bisect(const t_runner *r, const t_test *tests, size_t k)
+{
+    size_t  *seq = malloc((k + 1) * sizeof(*seq));
+    size_t  lo = 0;
+    size_t  hi = k;
+    size_t  n;
+    int     runs = 2;
+
+    if (!seq)
+        return ;
+    seq[0] = k;
+    if (chain_fails(r, tests, seq, 1))
+    {
+        printf("  %s fails on its own too\n", tests[k].name);
+        free(seq);
+        return ;
+    }
+    for (size_t i = 0; i <= k; i++)
+        seq[i] = i;
+    if (!chain_fails(r, tests, seq, k + 1))
+    {
+        printf("%s  ⚠ %s: could not reproduce the failure (flaky?)%s\n",
+               CLR_YELLOW, tests[k].name, CLR_RESET);
+        free(seq);
+        return ;
+    }
+    printf("  %s passes on its own; bisecting the %zu test%s before it...\n",
+           tests[k].name, k, k == 1 ? "" : "s");
+    while (hi - lo > 1)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+
+        for (size_t i = mid; i <= k; i++)
+            seq[i - mid] = i;
+        runs++;
+        if (chain_fails(r, tests, seq, k + 1 - mid))
+            lo = mid;
+        else
+            hi = mid;
+    }
+    n = 0;
+    for (size_t i = lo; i <= k; i++)
+        seq[n++] = i;
+    for (size_t j = 1; j + 1 < n;)
+    {
+        size_t dropped = seq[j];
+
+        memmove(seq + j, seq + j + 1, (n - j - 1) * sizeof(*seq));
+        runs++;
+        if (chain_fails(r, tests, seq, n - 1))
+        {
+            n--;
+            continue ;
+        }
+        memmove(seq + j + 1, seq + j, (n - j - 1) * sizeof(*seq));
+        seq[j++] = dropped;
+    }
+    print_sequence(tests, seq, n, runs);
+    free(seq);
+}
+
+static void report_order(const t_runner *r, const t_test *tests, size_t count,
+                         const char *failed, const size_t *since,
+                         const char *prog)
+{
+    size_t nfailed = 0;
+
+    for (size_t i = 0; i < count; i++)
+        nfailed += failed[i];
+    if (!nfailed)
+        return ;
+    printf("\n%s=== 🔎 Bisecting %zu failure%s (seed %llu) ===%s\n", CLR_YELLOW,
+           nfailed, nfailed == 1 ? "" : "s", (unsigned long long)r->seed, CLR_RESET);
+    fflush(stdout);
+    for (size_t i = 0; i < count; i++)
+        if (failed[i])
+            bisect(r, tests + since[i], i - since[i]);
+    printf("  rerun this order with: %s --shuffle --seed %llu\n", prog,
+           (unsigned long long)r->seed);
+}
+
+/* ========== Soak ========== */
+
+/* Sampled after every iteration. Nothing here may allocate through the
+ * wrappers or grow the heap itself, or the sampler would look like a
+ * leak: samples live in a fixed buffer that drops every other sample
+ * (and doubles its stride) whenever it fills up. */
+enum e_metric
+{
+    M_RSS,
+    M_FDS,
+    M_HEAP,
+    M_COUNT
+};
+
+static const struct
+{
+    const char  *name;
+    double      scale;
+    const char  *unit;
+}   g_metrics[M_COUNT] = {
+    {"RSS", 1024, "KiB"},
+    {"open fds", 1, ""},
+    {"heap in use", 1024, "KiB"},
+};
+
+typedef struct s_soak
+{
+    double          samples[SOAK_SAMPLES][M_COUNT];
+    unsigned long   at[SOAK_SAMPLES];
+    size_t          n;
+    unsigned long   stride;
+    unsigned long   iterations;
+    unsigned long   failed_iterations;
+    unsigned long   first_failure;
+}   t_soak;
+
+static t_soak   g_soak;
+
+static double sample_rss(void)
+{
+    FILE            *f = fopen("/proc/self/statm", "r");
+    unsigned long   size;
+    unsigned long   resident = 0;
+    struct rusage   ru;
+
+    if (f)
+    {
+        if (fscanf(f, "%lu %lu", &size, &resident) != 2)
+            resident = 0;
+        fclose(f);
+        if (resident)
+            return (double)resident * sysconf(_SC_PAGESIZE);
+    }
+    getrusage(RUSAGE_SELF, &ru);
+    return ru.ru_maxrss * 1024.0;
+}
+
+static double sample_fds(void)
+{
+    DIR     *dir = opendir("/proc/self/fd");
+    double  n = 0;
+
+    if (dir)
+    {
+        while (readdir(dir))
+            n++;
+        closedir(dir);
+        return n - 3;
+    }
+    for (int fd = 0; fd < 1024; fd++)
+        n += fcntl(fd, F_GETFD) != -1;
+    return n;
+}
+
+static double sample_heap(void)
+{
+#ifdef HAVE_MALLINFO2
+    struct mallinfo2 mi = mallinfo2();
+
+    return (double)mi.uordblks + (double)mi.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+static void soak_sample(t_soak *s)
+{
+    if (s->iterations <= SOAK_WARMUP
+        || (s->iterations - SOAK_WARMUP - 1) % s->stride)
+        return ;
+    if (s->n == SOAK_SAMPLES)
+    {
+        for (size_t i = 0; i < SOAK_SAMPLES / 2; i++)
+        {
+            memcpy(s->samples[i], s->samples[2 * i], sizeof(s->samples[i]));
+            s->at[i] = s->at[2 * i];
+        }
+        s->n = SOAK_SAMPLES / 2;
+        s->stride *= 2;
+        if ((s->iterations - SOAK_WARMUP - 1) % s->stride)
+            return ;
+    }
+    s->samples[s->n][M_RSS] = sample_rss();
+    s->samples[s->n][M_FDS] = sample_fds();
+    s->samples[s->n][M_HEAP] = sample_heap();
+    s->at[s->n++] = s->iterations;
+}
+
+/* Steady growth, not a single jump: the smallest sample of each quarter
+ * of the run must be larger than the one of the quarter before. Warm-up
+ * iterations are not sampled, so one-time allocations do not count. */
+static int soak_grows(const t_soak *s, int m)
+{
+    double  prev = 0;
+
+    for (size_t q = 0; q < 4; q++)
+    {
+        double low = s->samples[s->n * q / 4][m];
+
+        for (size_t i = s->n * q / 4; i < s->n * (q + 1) / 4; i++)
+            if (s->samples[i][m] < low)
+                low = s->samples[i][m];
+        if (q > 0 && low <= prev)
+            return 0;
+        prev = low;
+    }
+    return 1;
+}
+
+static void soak_report(const t_soak *s, const t_test *tests, size_t count,
+                        const long *blocks, double elapsed)
+{
+    char    msg[256];
+
+    printf("\n%s=== 🔁 Soak: %lu iterations in %.1f s ===%s\n",
+           CLR_YELLOW, s->iterations, elapsed, CLR_RESET);
+    metric("soak.iterations", s->iterations, "count");
+    if (s->failed_iterations)
+    {
+        snprintf(msg, sizeof(msg), "soak: checks failed in %lu of %lu iterations"
+                 " (first: iteration %lu)", s->failed_iterations,
+                 s->iterations, s->first_failure);
+        result_ko(msg);
+    }
+    if (s->n < SOAK_MIN_SAMPLES)
+    {
+        printf("%s  ⚠ only %zu samples after warm-up; soak longer to judge"
+               " drift%s\n", CLR_YELLOW, s->n, CLR_RESET);
+        return ;
+    }
+    printf("  %-12s %14s %14s %16s\n", "", "first", "last", "per 1k iter");
+    for (int m = 0; m < M_COUNT; m++)
+    {
+        double  first = s->samples[0][m];
+        double  last = s->samples[s->n - 1][m];
+        double  slope = (last - first) / (s->at[s->n - 1] - s->at[0]) * 1000;
+        int     grows;
+
+#ifndef HAVE_MALLINFO2
+        if (m == M_HEAP)
+            continue ;
+#endif
+        printf("  %-12s %10.0f %-3s %10.0f %-3s %+12.1f %-3s\n", g_metrics[m].name,
+               first / g_metrics[m].scale, g_metrics[m].unit,
+               last / g_metrics[m].scale, g_metrics[m].unit,
+               slope / g_metrics[m].scale, g_metrics[m].unit);
+        snprintf(msg, sizeof(msg), "soak.%s_per_1k_iter",
+                 m == M_RSS ? "rss" : m == M_FDS ? "fds" : "heap");
+        metric(msg, slope, m == M_FDS ? "count" : "B");
+        grows = soak_grows(s, m);
+        snprintf(msg, sizeof(msg), "soak: %s %s", g_metrics[m].name,
+                 grows ? "grows steadily" : "stays flat");
+        if (grows)
+            result_ko(msg);
+        else
+            result_ok(msg);
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        if (blocks[i] <= 0)
+            continue ;
+        snprintf(msg, sizeof(msg), "soak: %s keeps %ld block%s over %lu"
+                 " iterations", tests[i].name, blocks[i], blocks[i] == 1 ? "" : "s",
+                 s->iterations - SOAK_WARMUP);
+        result_ko(msg);
+    }
+}
+
+/* The whole suite again and again in this process, with stdout sent to
+ * /dev/null, so anything an ft_* function forgets to release piles up
+ * where the samples can see it. Net blocks (malloc'ed minus freed through
+ * the wrappers) are also counted per test to name the one that leaks. */
+static void soak(const t_runner *r, const t_test *tests, size_t count)
+{
+    t_runner    quiet = *r;
+    t_soak      *s = &g_soak;
+    long        *blocks = calloc(count, sizeof(*blocks));
+    int         run = tests_run;
+    int         passed = tests_passed;
+    double      start = now_s();
+    int         null = open("/dev/null", O_WRONLY);
+
+    if (!blocks || null < 0)
+    {
+        perror("monsters: soak");
+        exit(1);
+    }
+    quiet.leaks = 0;
+    s->n = 0;
+    s->stride = 1;
+    s->iterations = 0;
+    s->failed_iterations = 0;
+    fflush(stdout);
+    g_out = dup(STDOUT_FILENO);
+    dup2(null, STDOUT_FILENO);
+    progress_start("iterations", 0, r->soak, 1);
+    while (now_s() - start < r->soak)
+    {
+        int before = tests_run - tests_passed;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            t_alloc_stats   a;
+            t_alloc_stats   b;
+
+            progress_current(tests[i].name);
+            alloc_stats_get(&a);
+            run_in_process(&quiet, &tests[i], (int)i + 1);
+            alloc_stats_get(&b);
+            if (s->iterations >= SOAK_WARMUP)
+                blocks[i] += (long)(b.mallocs - a.mallocs) - (long)(b.frees - a.frees);
+        }
+        s->iterations++;
+        if (tests_run - tests_passed != before && !s->failed_iterations++)
+            s->first_failure = s->iterations;
+        progress_add(1, tests_run - tests_passed == before,
+                     tests_run - tests_passed != before);
+        soak_sample(s);
+    }
+    progress_stop();
+    fflush(stdout);
+    dup2(g_out, STDOUT_FILENO);
+    close(g_out);
+    close(null);
+    g_out = STDOUT_FILENO;
+    tests_run = run;
+    tests_passed = passed;
+    soak_report(s, tests, count, blocks, now_s() - start);
+    free(blocks);
+}
+
+/* ========== Fork Server ========== */
+
+/* --fork-server: monsters_mutate keeps this process alive and sends it
+ * one line per mutant on stdin,
+ *     <mutant.so> <function>...      or      -  (nothing patched)
+ * and a forked child loads the .so, turns the entry of each listed
+ * function in this binary into a jump to the mutant's copy and runs the
+ * suite up to the first test that does not pass. One reply line goes to
+ * the original stdout:
+ *     killed <test> <fail|crash|timeout> | survived | unreached | error <why>
+ * The jump needs the padding -fpatchable-function-entry leaves at every
+ * function entry, so libft has to be built with it (make mutate). A
+ * static binary cannot dlopen() the mutants: there (-DMONSTERS_STATIC)
+ * the option only says so. */
+#ifdef MONSTERS_STATIC
+
+static void fork_server(const t_runner *r, const t_test *tests, size_t count)
+{
+    (void)r;
+    (void)tests;
+    (void)count;
+    fprintf(stderr, "%s❌ --fork-server needs the dynamic build "
+            "(dlopen() of the mutants)%s\n", CLR_RED, CLR_RESET);
+    exit(2);
+}
+
+#else
+
+static int  g_reply = -1;
+
+static int patch_jump(void *from, void *to)
+{
+    unsigned char   *p = from;
+    unsigned char   code[16];
+    size_t          size = 0;
+    long            page = sysconf(_SC_PAGESIZE);
+    uintptr_t       start;
+
+#if defined(__x86_64__)
+    if (memcmp(p, "\xf3\x0f\x1e\xfa", 4) == 0)
+        p += 4;
+    size = 12;
+    memcpy(code, "\x48\xb8", 2);
+    memcpy(code + 2, &to, sizeof(to));
+    memcpy(code + 10, "\xff\xe0", 2);
+    for (size_t i = 0; i < size; i++)
+        if (p[i] != 0x90)
+            return -1;
+#elif defined(__aarch64__)
+    static const uint32_t   insn[3] = {0x58000050, 0xd61f0200, 0xd503201f};
+
+    if (memcmp(p, "\x5f\x24\x03\xd5", 4) == 0)
+        p += 4;
+    size = 16;
+    memcpy(code, insn, 8);
+    memcpy(code + 8, &to, sizeof(to));
+    for (size_t i = 0; i < size; i += 4)
+        if (memcmp(p + i, &insn[2], 4) != 0)
+            return -1;
+#else
+    (void)to;
+    return -1;
+#endif
+    start = (uintptr_t)p & ~(uintptr_t)(page - 1);
+    if (mprotect((void *)start, (uintptr_t)p + size - start,
+                 PROT_READ | PROT_WRITE | PROT_EXEC) < 0)
+        return -1;
+    memcpy(p, code, size);
+    __builtin___clear_cache((char *)p, (char *)p + size);
+    return 0;
+}
+
+/* Child side of one request; never returns. The tests named after the
+ * patched functions run first, since they are the likeliest to fail. */
+static void serve_mutant(const t_runner *r, const t_test *tests, size_t count,
+                         char *line)
+{
+    char    *save;
+    char    *so = strtok_r(line, " \n", &save);
+    void    *handle = NULL;
+    char    *first = calloc(count, 1);
+    t_test  *order = malloc(count * sizeof(*order));
+    int     patched = 0;
+    size_t  n = 0;
+
+    if (!first || !order || !so)
+        _exit(1);
+    if (strcmp(so, "-") != 0 && !(handle = dlopen(so, RTLD_NOW | RTLD_LOCAL)))
+    {
+        dprintf(g_reply, "error %s\n", dlerror());
+        _exit(0);
+    }
+    for (char *fn; handle && (fn = strtok_r(NULL, " \n", &save));)
+    {
+        void *to = dlsym(handle, fn);
+        void *from = dlsym(RTLD_DEFAULT, fn);
+
+        if (!to || !from || to == from)
+            continue ;
+        if (patch_jump(from, to) < 0)
+        {
+            dprintf(g_reply, "error %s has no patchable entry\n", fn);
+            _exit(0);
+        }
+        patched++;
+        for (size_t i = 0; i < count; i++)
+            first[i] |= strncmp(fn, "ft_", 3) == 0
+                        && strncmp(tests[i].name, "test_", 5) == 0
+                        && strcmp(tests[i].name + 5, fn + 3) == 0;
+    }
+    if (handle && !patched)
+    {
+        dprintf(g_reply, "unreached\n");
+        _exit(0);
+    }
+    for (int pass = 1; pass >= 0; pass--)
+        for (size_t i = 0; i < count; i++)
+            if (first[i] == pass)
+                order[n++] = tests[i];
+    for (size_t i = 0; i < n; i++)
+    {
+        g_how = "fail";
+        run_forked(r, &order[i], (int)i + 1);
+        if (tests_run != tests_passed)
+        {
+            dprintf(g_reply, "killed %s %s\n", order[i].name, g_how);
+            _exit(0);
+        }
+    }
+    dprintf(g_reply, "survived\n");
+    _exit(0);
+}
+
+static void fork_server(const t_runner *r, const t_test *tests, size_t count)
+{
+    char    *line = NULL;
+    size_t  cap = 0;
+    int     null = open("/dev/null", O_WRONLY);
+
+    g_reply = dup(STDOUT_FILENO);
+    if (g_reply < 0 || null < 0 || dup2(null, STDOUT_FILENO) < 0)
+    {
+        perror("monsters: fork server");
+        exit(1);
+    }
+    close(null);
+    dprintf(g_reply, "ready\n");
+    while (getline(&line, &cap, stdin) > 0)
+    {
+        pid_t   pid = fork();
+        int     status;
+
+        if (pid < 0)
+        {
+            perror("monsters: fork");
+            exit(1);
+        }
+        if (pid == 0)
+            serve_mutant(r, tests, count, line);
+        waitpid(pid, &status, 0);
+        if (WIFSIGNALED(status))
+            dprintf(g_reply, "error loading the mutant: %s\n", strsignal(WTERMSIG(status)));
+        else if (WEXITSTATUS(status) != 0)
+            dprintf(g_reply, "error bad request or out of memory\n");
+    }
+    free(line);
+    exit(0);
+}
+
+#endif
+
+/* ========== Startup Latency ========== */
+
+/* --startup N: the binary runs itself N times. Each child gets the
+ * time taken just before its execv() in $MONSTERS_STARTUP, with the fd
+ * to report on, and answers with three intervals: exec to the end of
+ * the constructors (dynamic loader, relocations, libc and static init),
+ * from there to run_tests() (main's preamble) and the first test. */
+#define STARTUP_PHASES  4
+
+static double   g_init_done;
+
+__attribute__((constructor))
+static void mark_init_done(void)
+{
+    g_init_done = now_s();
+}
+
+static void startup_child(const t_runner *r, const t_test *tests,
+                          const char *env)
+{
+    double  suite = now_s();
+    double  exec_at = atof(env);
+    int     fd = atoi(strchr(env, ':') ? strchr(env, ':') + 1 : "-1");
+    double  first;
+
+    run_one(r, &tests[0], 1);
+    first = now_s();
+    dprintf(fd, "%.9f %.9f %.9f\n", g_init_done - exec_at, suite - g_init_done,
+            first - suite);
+    exit(0);
+}
+
+static int by_value(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+
+    return (x > y) - (x < y);
+}
+
+static void print_phase(const char *label, const char *key, double *v, int n)
+{
+    double  median;
+    double  p95;
+
+    qsort(v, n, sizeof(*v), by_value);
+    median = v[n / 2];
+    p95 = v[(int)(n * 0.95) < n ? (int)(n * 0.95) : n - 1];
+    printf("   %-24s %9.1f µs  %9.1f µs  %9.1f µs\n", label, v[0] * 1e6,
+           median * 1e6, p95 * 1e6);
+    metric(key, median * 1e6, "us");
+}
+
+/* Times r->startup launches of /proc/self/exe (argv[0] may not be a
+ * path); the whole-process column also has fork(), exit() and the wait
+ * in it. Each launch gets its own pipe, and the parent closes the write
+ * end at once: a child that dies before reporting ends the read with EOF */
+static void startup(const t_runner *r, const char *self)
+{
+    double      *v = calloc((size_t)r->startup * STARTUP_PHASES, sizeof(*v));
+    double      *total = calloc(r->startup, sizeof(*total));
+    struct stat st;
+    int         n = 0;
+
+    if (!v || !total)
+    {
+        perror("monsters: startup");
+        exit(1);
+    }
+    for (int i = 0; i < r->startup; i++)
+    {
+        double  t0 = now_s();
+        double  phase[3];
+        char    env[64];
+        char    line[128];
+        int     fds[2];
+        pid_t   pid;
+        ssize_t len;
+        int     status;
+
+        if (pipe(fds) < 0)
+            break ;
+        if ((pid = fork()) == 0)
+        {
+            int null = open("/dev/null", O_WRONLY);
+
+            close(fds[0]);
+            dup2(null, STDOUT_FILENO);
+            snprintf(env, sizeof(env), "%.9f:%d", now_s(), fds[1]);
+            setenv("MONSTERS_STARTUP", env, 1);
+            execl("/proc/self/exe", self, (char *)NULL);
+            _exit(127);
+        }
+        close(fds[1]);
+        if (pid < 0)
+        {
+            close(fds[0]);
+            break ;
+        }
+        len = read(fds[0], line, sizeof(line) - 1);
+        close(fds[0]);
+        waitpid(pid, &status, 0);
+        if (len <= 0)
+            break ;
+        line[len] = '\0';
+        if (sscanf(line, "%lf %lf %lf", &phase[0], &phase[1], &phase[2]) != 3)
+            break ;
+        v[n] = phase[0];
+        v[r->startup + n] = phase[1];
+        v[2 * r->startup + n] = phase[2];
+        v[3 * r->startup + n] = phase[0] + phase[1] + phase[2];
+        total[n++] = now_s() - t0;
+    }
+    if (n < r->startup)
+    {
+        fprintf(stderr, "%s❌ %s: launch %d did not report its startup%s\n",
+                CLR_RED, self, n + 1, CLR_RESET);
+        exit(1);
+    }
+    printf("\n%s🚀 Startup of %s (%s, %lld KiB): %d runs%s\n", CLR_CYAN, self,
+           getauxval(AT_BASE) ? "dynamic" : "static",
+           stat("/proc/self/exe", &st) == 0 ? (long long)st.st_size / 1024 : 0LL,
+           n, CLR_RESET);
+    printf("   %-24s %12s  %12s  %12s\n", "", "min", "median", "p95");
+    print_phase("loader + static init", "startup.init", v, n);
+    print_phase("main until the suite", "startup.main", v + r->startup, n);
+    print_phase("first test", "startup.first_test", v + 2 * r->startup, n);
+    print_phase("exec to first test done", "startup.total", v + 3 * r->startup, n);
+    print_phase("whole process", "startup.process", total, n);
+    free(v);
+    free(total);
+    exit(0);
+}
+
+/* ========== Runner ========== */
+
+/* The live status line would be torn apart by the tests' own output, so
+ * it is only drawn when stdout goes somewhere else than the terminal */
+void run_tests(const t_test *tests, size_t count, int argc, char **argv)
+{
+    t_runner    r;
+    t_test      *order = NULL;
+    char        *failed = NULL;
+    size_t      *since = NULL;
+
+    parse_args(&r, argc, argv);
+    if (getenv("MONSTERS_STARTUP"))
+        startup_child(&r, tests, getenv("MONSTERS_STARTUP"));
+    if (r.startup > 0)
+        startup(&r, argv[0]);
+    if (r.fork_server)
+        fork_server(&r, tests, count);
+    if (r.shuffle)
+    {
+        order = shuffle(tests, count, r.seed);
+        tests = order;
+        printf("\n%s🔀 Shuffled order, seed %llu%s\n", CLR_CYAN,
+               (unsigned long long)r.seed, CLR_RESET);
+    }
+    progress_start("tests", count, 0, !isatty(STDOUT_FILENO));
+    if (r.shuffle && r.fork)
+    {
+        failed = calloc(count, 1);
+        since = calloc(count, sizeof(*since));
+        if (!failed || !since)
+        {
+            perror("monsters: shuffle");
+            exit(1);
+        }
+        run_chain(&r, tests, count, failed, since);
+    }
+    for (size_t i = 0; i < count && !failed; i++)
+    {
+        int run = tests_run;
+        int passed = tests_passed;
+
+        if (tests[i].part)
+            part_header(tests[i].part);
+        progress_current(tests[i].name);
+        if (r.fork)
+            run_forked(&r, &tests[i], (int)i + 1);
+        else
+            run_in_process(&r, &tests[i], (int)i + 1);
+        progress_add(1, tests_passed - passed, (tests_run - run) - (tests_passed - passed));
+    }
+    progress_stop();
+    if (failed)
+        report_order(&r, tests, count, failed, since, argv[0]);
+    if (r.soak > 0)
+        soak(&r, tests, count);
+    free(failed);
+    free(since);
+    free(order);
+}
@@ -19,6 +19,10 @@
 # include <stdint.h>
 # include <limits.h>
 # include <ctype.h>
+# include <signal.h>
+# include <pthread.h>
+# include <sys/wait.h>
+# include <sys/resource.h>
 # include "libft.h"
 
 /* 🎨 ANSI Color Codes */
@@ -35,9 +39,27 @@
 extern int tests_run;
 extern int tests_passed;
 
-/* 💀 Animated banner */
+/* 📋 Test table: every suite lists its test_* functions in run order.
+ *    PART() opens a new section header before its test. */
+typedef struct s_test
+{
+    const char  *name;
+    void        (*fn)(void);
+    const char  *part;
+}   t_test;
+
+# define TEST(fn)         { #fn, fn, NULL }
+# define PART(title, fn)  { #fn, fn, title }
+# define TEST_COUNT(tab)  (sizeof(tab) / sizeof((tab)[0]))
+
+/* Implemented in test_runner.c */
+void    run_tests(const t_test *tests, size_t count, int argc, char **argv);
+
+/* 💀 Animated banner; only animated on a terminal, where someone watches */
 static inline void banner(void)
 {
+    int animate = isatty(STDOUT_FILENO);
+
     const char *lines[] = {
         " __  __                 _                 _____         _   ",
         "|  \\/  | ___  _ __  ___| |_ ___ _ __ ___|_   _|__  ___| |_ ",
@@ -55,11 +77,21 @@ static inline void banner(void)
     {
         printf("%s\n", lines[i]);
         fflush(stdout);
-        usleep(60000);
+        if (animate)
+            usleep(60000);
     }
     printf("%s\n", CLR_RESET);
 }
 
+static inline void part_header(const char *title)
+{
+    printf("\n%s%s╔════════════════════════════════════════════════╗%s\n",
+           CLR_BOLD, CLR_CYAN, CLR_RESET);
+    printf("%s%s║    %-44s║%s\n", CLR_BOLD, CLR_CYAN, title, CLR_RESET);
+    printf("%s%s╚════════════════════════════════════════════════╝%s\n",
+           CLR_BOLD, CLR_CYAN, CLR_RESET);
+}
+
 /* ✅ Test helpers */
 static inline void result_ok(const char *msg)
 {
@@ -74,6 +106,92 @@ static inline void result_ko(const char *msg)
     tests_run++;
 }
 
+/* 🧵 Isolated runs: fn(ctx) executes on a thread with a bounded stack
+ *    inside a forked child, so a stack overflow or crash cannot take the
+ *    whole suite down. ctx is copied back from the child when fn returns.
+ *    Returns 0 on success, the signal number that killed the child
+ *    (SIGSEGV on stack overflow), or -1 on any other failure. */
+typedef struct s_isolated_job
+{
+    void    (*fn)(void *);
+    void    *ctx;
+}   t_isolated_job;
+
+static inline void *isolated_trampoline(void *arg)
+{
+    t_isolated_job *job = arg;
+
+    job->fn(job->ctx);
+    return NULL;
+}
+
+static inline int run_isolated(void (*fn)(void *), void *ctx, size_t ctx_size,
+                               size_t stack_size, long *maxrss_kb)
+{
+    int             fds[2];
+    pid_t           pid;
+    int             status;
+    struct rusage   ru;
+    size_t          got = 0;
+    ssize_t         n;
+
+    if (pipe(fds) < 0)
+        return -1;
+    pid = fork();
+    if (pid < 0)
+    {
+        close(fds[0]);
+        close(fds[1]);
+        return -1;
+    }
+    if (pid == 0)
+    {
+        t_isolated_job  job = {fn, ctx};
+        pthread_attr_t  attr;
+        pthread_t       thread;
+        size_t          sent = 0;
+
+        close(fds[0]);
+        pthread_attr_init(&attr);
+        if (stack_size)
+            pthread_attr_setstacksize(&attr, stack_size);
+        if (pthread_create(&thread, &attr, isolated_trampoline, &job) != 0)
+            _exit(127);
+        pthread_join(thread, NULL);
+        while (sent < ctx_size
+               && (n = write(fds[1], (char *)ctx + sent, ctx_size - sent)) > 0)
+            sent += n;
+        _exit(sent == ctx_size ? 0 : 1);
+    }
+    close(fds[1]);
+    while (got < ctx_size
+           && (n = read(fds[0], (char *)ctx + got, ctx_size - got)) > 0)
+        got += n;
+    close(fds[0]);
+    if (wait4(pid, &status, 0, &ru) < 0)
+        return -1;
+    if (maxrss_kb)
+        *maxrss_kb = ru.ru_maxrss;
+    if (WIFSIGNALED(status))
+        return WTERMSIG(status);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0 || got != ctx_size)
+        return -1;
+    return 0;
+}
+
+/* 📈 Machine-readable results: when MONSTERS_METRICS names a file, each
+ *    metric is appended to it as "key<TAB>value<TAB>unit" */
+static inline void metric(const char *key, double value, const char *unit)
+{
+    const char  *path = getenv("MONSTERS_METRICS");
+    FILE        *f;
+
+    if (!path || !*path || !(f = fopen(path, "a")))
+        return ;
+    fprintf(f, "%s\t%.6g\t%s\n", key, value, unit);
+    fclose(f);
+}
+
 static inline void summary(void)
 {
     printf("\n%s%s", CLR_BOLD, CLR_CYAN);
@@ -90,6 +208,8 @@ static inline void summary(void)
            tests_run - tests_passed, CLR_RESET);
     printf("%sSuccess rate: %s%.1f%%%s\n\n", CLR_BOLD, 
            percentage == 100 ? CLR_GREEN : CLR_YELLOW, percentage, CLR_RESET);
+    metric("tests.run", tests_run, "count");
+    metric("tests.passed", tests_passed, "count");
 }
 
 #endif
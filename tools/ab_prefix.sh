@@ -0,0 +1,52 @@
+#!/bin/sh
+# **************************************************************************** #
+#   ab_prefix.sh - rename every symbol of a libft archive for A/B builds       #
+#                                                                              #
+#   usage: tools/ab_prefix.sh <in.a> <out.a> [<prefix>]                        #
+#                                                                              #
+#   objcopy --prefix-symbols renames definitions and references alike, so the  #
+#   copy's calls to malloc, memcpy or __stack_chk_fail would point at          #
+#   b_malloc... Every undefined symbol that the archive does not define        #
+#   itself is renamed back; calls between its own functions keep the prefix.  #
+# **************************************************************************** #
+
+IN=$1
+OUT=$2
+PREFIX=${3:-b_}
+NM=${NM:-nm}
+OBJCOPY=${OBJCOPY:-objcopy}
+
+if [ ! -f "$IN" ] || [ -z "$OUT" ]; then
+    echo "usage: $0 <in.a> <out.a> [<prefix>]"
+    exit 1
+fi
+TMP=$(mktemp) || exit 1
+trap 'rm -f "$TMP"' EXIT
+
+$OBJCOPY --prefix-symbols="$PREFIX" "$IN" "$OUT" || exit 1
+
+# "b_malloc malloc" for each prefixed reference with no prefixed definition
+{
+    $NM --defined-only "$OUT" | awk 'NF == 3 { print "D", $3 }'
+    $NM -u "$OUT" | awk 'NF == 2 && $1 == "U" { print "U", $2 }'
+} | awk -v p="$PREFIX" '
+    $1 == "D" { def[$2] = 1 }
+    $1 == "U" && index($2, p) == 1 { ref[$2] = 1 }
+    END {
+        for (s in ref)
+            if (!(s in def))
+                print s, substr(s, length(p) + 1)
+    }' > "$TMP"
+
+if [ -s "$TMP" ]; then
+    $OBJCOPY --redefine-syms="$TMP" "$OUT" || exit 1
+fi
+
+# Nothing of the original names may be left defined
+LEFT=$($NM --defined-only "$OUT" | awk -v p="$PREFIX" '
+    NF == 3 && $2 ~ /[TDBRW]/ && index($3, p) != 1 { print $3 }')
+if [ -n "$LEFT" ]; then
+    echo "❌ $OUT still defines: $LEFT"
+    exit 1
+fi
+echo "🔀 $OUT: symbols prefixed with $PREFIX ($(wc -l < "$TMP" | tr -d ' ') external references kept)"
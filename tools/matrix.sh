@@ -0,0 +1,106 @@
+#!/bin/sh
+# **************************************************************************** #
+#   matrix.sh - compiler x optimization matrix for libft_master_tester          #
+#                                                                              #
+#   usage: tools/matrix.sh "<compilers>" "<levels>" "<bench_b args>"           #
+#                          ["<bench_m args>"]                                  #
+#   levels: O0 O1 O2 O3 Os O3-lto (-O3 -flto -march=native)                    #
+#                                                                              #
+#   Every cell builds libft and the tester from source (make matrix_one),      #
+#   runs both suites and both benchmarks with MONSTERS_METRICS set, and        #
+#   the collected metrics are printed as one table with a column per cell.     #
+# **************************************************************************** #
+
+CCS=$1
+OPTS=$2
+BENCH_ARGS=$3
+BENCH_M_ARGS=$4
+MAKE=${MAKE:-make}
+ROOT=build/matrix
+CELLS=""
+
+# run <dir> <label> <binary> [args...]: runs one binary of a cell and
+# appends its metrics, prefixed with <label>, to <dir>/metrics.tsv
+run()
+{
+    dir=$1; label=$2; bin=$3; shift 3
+    rm -f "$dir/$label.tsv"
+    MONSTERS_METRICS="$dir/$label.tsv" "./$dir/$bin" "$@" > "$dir/$label.log" 2>&1
+    status=$?
+    if [ -f "$dir/$label.tsv" ]; then
+        awk -F'\t' -v p="$label" '
+            $1 == "tests.run"    { run = $2; next }
+            $1 == "tests.passed" { passed = $2; next }
+            { printf "%s.%s\t%s\t%s\n", p, $1, $2, $3 }
+            END { if (run != "") printf "%s.tests\t%s/%s\tpassed\n", p, passed, run }
+        ' "$dir/$label.tsv" >> "$dir/metrics.tsv"
+    fi
+    if [ $status -ne 0 ]; then
+        printf "%s.exit\t%s\tstatus\n" "$label" "$status" >> "$dir/metrics.tsv"
+        echo "   ❌ $label exited with status $status (see $dir/$label.log)"
+    fi
+}
+
+for cc in $CCS; do
+    if ! command -v "$cc" > /dev/null 2>&1; then
+        echo "⚠️  $cc not found, skipping its column"
+        continue
+    fi
+    case $cc in
+        *clang*) lto_ar=llvm-ar ;;
+        *)       lto_ar=gcc-ar ;;
+    esac
+    for opt in $OPTS; do
+        ar=ar
+        case $opt in
+            O3-lto) flags="-O3 -flto -march=native"; ar=$lto_ar ;;
+            O*)     flags="-$opt" ;;
+            *)      echo "⚠️  unknown level '$opt', skipping"; continue ;;
+        esac
+        name="$cc-$opt"
+        dir="$ROOT/$name"
+        CELLS="$CELLS $name"
+        mkdir -p "$dir"
+        rm -f "$dir/metrics.tsv"
+        echo "🔨 [$name] $cc $flags"
+        if ! $MAKE --no-print-directory matrix_one MX_NAME="$name" MX_CC="$cc" \
+                MX_OPT="$flags" MX_AR="$ar" > "$dir/build.log" 2>&1; then
+            printf "build\tfailed\t-\n" > "$dir/metrics.tsv"
+            echo "   ❌ build failed (see $dir/build.log)"
+            continue
+        fi
+        run "$dir" mandatory monsters_test_m
+        run "$dir" bonus monsters_test_b
+        # shellcheck disable=SC2086
+        run "$dir" bench_m monsters_bench_m $BENCH_M_ARGS
+        # shellcheck disable=SC2086
+        run "$dir" bench_b monsters_bench_b $BENCH_ARGS
+    done
+done
+
+[ -n "$CELLS" ] || { echo "❌ no compiler available"; exit 1; }
+
+# Pivot: one row per metric (first-seen order), one column per cell. When
+# a benchmark reports a metric for several sizes, the last (largest) wins.
+echo
+for cell in $CELLS; do
+    awk -F'\t' -v c="$cell" '{ print c "\t" $0 }' "$ROOT/$cell/metrics.tsv"
+done | awk -F'\t' -v cells="$CELLS" '
+    {
+        if (!(($2) in seen)) { seen[$2] = 1; keys[++nk] = $2; unit[$2] = $4 }
+        val[$1, $2] = $3
+    }
+    END {
+        nc = split(cells, col, " ")
+        printf "\033[1m%-28s %-9s", "metric", "unit"
+        for (i = 1; i <= nc; i++) printf " %12s", col[i]
+        printf "\033[0m\n"
+        for (k = 1; k <= nk; k++) {
+            printf "%-28s %-9s", keys[k], unit[keys[k]]
+            for (i = 1; i <= nc; i++) {
+                v = ((col[i], keys[k]) in val) ? val[col[i], keys[k]] : "-"
+                printf " %12s", v
+            }
+            printf "\n"
+        }
+    }'
@@ -0,0 +1,239 @@
+#!/bin/sh
+# **************************************************************************** #
+#   size_report.sh - code size and instruction footprint of libft.a            #
+#                                                                              #
+#   usage: tools/size_report.sh [--save] <libft.a> <baseline.tsv> [<tol %>]    #
+#                                                                              #
+#   Lists every function in the archive with its text size (nm), the 64-byte   #
+#   cache lines it spans, its basic blocks and the functions it calls out to   #
+#   (objdump -dr). With --save the table becomes the new baseline; otherwise   #
+#   it is compared with the baseline and growth beyond <tol> percent (default  #
+#   10) or a new callee is flagged as a regression, with exit status 1.        #
+# **************************************************************************** #
+
+SAVE=0
+if [ "$1" = "--save" ]; then
+    SAVE=1
+    shift
+fi
+LIB=$1
+BASELINE=$2
+TOL=${3:-10}
+NM=${NM:-nm}
+OBJDUMP=${OBJDUMP:-objdump}
+
+if [ ! -f "$LIB" ]; then
+    echo "❌ $LIB not found"
+    exit 1
+fi
+TMP=$(mktemp -d) || exit 1
+trap 'rm -rf "$TMP"' EXIT
+
+# Text symbols as "object<TAB>type<TAB>name<TAB>bytes"; with -A every line
+# starts with archive:object:, and the size field is decimal with -t d
+$NM -A --size-sort -t d --defined-only "$LIB" 2>/dev/null | awk '
+    {
+        n = split($1, part, ":")
+        if (NF == 3 && $2 ~ /^[TtWw]$/)
+            printf "%s\t%s\t%s\t%d\n", part[n - 1], $2, $3, part[n] + 0
+    }' > "$TMP/nm.tsv"
+
+# One row per function: name, bytes, blocks, callees. A block starts at
+# the entry, at every branch target inside the function and after every
+# branch or return. Callees come from the relocations of call and jump
+# instructions (tail calls), or from the <symbol> of a linked call.
+$OBJDUMP -dr --no-show-raw-insn "$LIB" 2>/dev/null | awk -F'\t' -v nm="$TMP/nm.tsv" '
+    function hex(s,    i, v) {
+        v = 0
+        s = tolower(s)
+        for (i = 1; i <= length(s); i++)
+            v = v * 16 + index("0123456789abcdef", substr(s, i, 1)) - 1
+        return v
+    }
+    function finish(    a, i, blocks) {
+        if (fn == "")
+            return
+        blocks = 0
+        for (i = 1; i <= ninsn; i++) {
+            a = addr[i]
+            if (i == 1 || (a in leader))
+                blocks++
+        }
+        key = obj "\t" fn
+        nblocks[key] = blocks
+        fn = ""
+    }
+    function add_callee(name) {
+        sub(/[-+]0x[0-9a-f]+$/, "", name)
+        sub(/@plt$/, "", name)
+        if (name == "" || index(" " callees[obj "\t" fn] " ", " " name " "))
+            return
+        callees[obj "\t" fn] = callees[obj "\t" fn] (callees[obj "\t" fn] == "" ? "" : " ") name
+    }
+    BEGIN {
+        while ((getline line < nm) > 0) {
+            split(line, f, "\t")
+            size[f[1] "\t" f[3]] = f[4]
+            type[f[1] "\t" f[3]] = f[2]
+        }
+    }
+    /^[^ \t].*\.o:[ \t]+file format/ {
+        finish()
+        obj = $0
+        sub(/:.*/, "", obj)
+        next
+    }
+    /^[0-9a-f]+ <.+>:$/ {
+        finish()
+        fn = $0
+        sub(/^[0-9a-f]+ </, "", fn)
+        sub(/>:$/, "", fn)
+        ninsn = 0
+        split("", leader)
+        last = ""
+        after_branch = 0
+        next
+    }
+    fn != "" && /^[ \t]+[0-9a-f]+:[ \t]R_/ {
+        # relocation of the previous instruction
+        if (last == "call" || last == "jump") {
+            n = split($0, r, /[ \t]+/)
+            if (r[n - 1] ~ /(PLT32|PC32|CALL26|JUMP26)$/)
+                add_callee(r[n])
+            if (last == "jump")
+                delete leader[target]
+        }
+        next
+    }
+    fn != "" && /^[ \t]+[0-9a-f]+:\t/ {
+        a = $1
+        gsub(/[ \t:]/, "", a)
+        addr[++ninsn] = hex(a)
+        if (after_branch)
+            leader[hex(a)] = 1
+        after_branch = 0
+        ins = NF > 2 ? $2 " " $3 : $2
+        sub(/^(rep|repz|bnd|notrack|lock) +/, "", ins)
+        m = ins
+        sub(/[ \t].*/, "", m)
+        ops = substr(ins, length(m) + 1)
+        last = ""
+        if (m ~ /^call/ || m == "bl" || m == "blr") {
+            last = "call"
+            if (ops ~ /\*/ || m == "blr")
+                add_callee("*indirect")
+            else if (match(ops, /<[^>+]+>/))
+                add_callee(substr(ops, RSTART + 1, RLENGTH - 2))
+        } else if (m ~ /^j/ || m ~ /^(b|b\..*|br|cbn?z|tbn?z)$/) {
+            last = "jump"
+            after_branch = 1
+            target = ""
+            if (match(ops, /[0-9a-f]+ <[^>]+>/)) {
+                sym = substr(ops, RSTART, RLENGTH)
+                split(sym, s, " ")
+                inner = s[2]
+                gsub(/[<>]/, "", inner)
+                sub(/\+0x[0-9a-f]+$/, "", inner)
+                if (inner == fn) {
+                    target = hex(s[1])
+                    leader[target] = 1
+                } else
+                    add_callee(inner)
+            }
+        } else if (m ~ /^ret/ || m == "ud2" || m == "hlt") {
+            after_branch = 1
+        }
+        next
+    }
+    END {
+        finish()
+        for (key in size) {
+            split(key, k, "\t")
+            name = type[key] ~ /[tw]/ ? k[1] ":" k[2] : k[2]
+            printf "%s\t%d\t%d\t%s\n", name, size[key], (key in nblocks) ? nblocks[key] : 0,
+                   (key in callees) ? callees[key] : "-"
+        }
+    }' | sort -t"$(printf '\t')" -k2,2nr -k1,1 > "$TMP/size.tsv"
+
+if [ ! -s "$TMP/size.tsv" ]; then
+    echo "❌ no functions found in $LIB (is $NM/$OBJDUMP binutils?)"
+    exit 1
+fi
+ARCH=$($OBJDUMP -f "$LIB" 2>/dev/null | awk '/file format/ { print $NF; exit }')
+
+if [ $SAVE -eq 1 ]; then
+    cp "$TMP/size.tsv" "$BASELINE" || exit 1
+    echo "💾 Saved $(wc -l < "$BASELINE" | tr -d ' ') functions to $BASELINE"
+fi
+[ -f "$BASELINE" ] || BASELINE=/dev/null
+
+awk -F'\t' -v tol="$TOL" -v lib="$LIB" -v arch="$ARCH" -v base="$BASELINE" '
+    function lines(b) { return int((b + 63) / 64) }
+    function grew(new, old) { return new > old && (new - old) * 100 > old * tol }
+    FILENAME == base {
+        old_bytes[$1] = $2; old_blocks[$1] = $3; old_calls[$1] = $4
+        old_total += $2
+        nold++
+        next
+    }
+    {
+        name[++n] = $1; bytes[n] = $2; blocks[n] = $3; calls[n] = $4
+        total += $2
+        cache += lines($2)
+        seen[$1] = 1
+    }
+    END {
+        R = "\033[31m"; G = "\033[32m"; Y = "\033[33m"; B = "\033[1m"; Z = "\033[0m"
+        printf "\n%s📏 %s (%s): %d functions, %d bytes of text in %d cache lines%s\n",
+               B, lib, arch, n, total, cache, Z
+        printf "  %-26s %7s %8s %6s %7s  %s\n", "function", "bytes", "change", "lines", "blocks", "calls out"
+        for (i = 1; i <= n; i++) {
+            delta = ""
+            color = ""
+            f = name[i]
+            if (!nold)
+                delta = ""
+            else if (!(f in old_bytes)) {
+                delta = "new"
+                color = Y
+            } else if (bytes[i] != old_bytes[f]) {
+                delta = sprintf("%+d", bytes[i] - old_bytes[f])
+                color = bytes[i] < old_bytes[f] ? G : grew(bytes[i], old_bytes[f]) ? R : ""
+            }
+            added = ""
+            if ((f in old_calls) && calls[i] != "-") {
+                m = split(calls[i], c, " ")
+                for (j = 1; j <= m; j++)
+                    if (index(" " old_calls[f] " ", " " c[j] " ") == 0)
+                        added = added " " c[j]
+            }
+            if (color == R || added != "") {
+                bad++
+                why[bad] = sprintf("%s: %s", f, color == R ? sprintf("%d → %d bytes", old_bytes[f], bytes[i]) \
+                                                           : "now calls" added)
+                if (color == R && added != "")
+                    why[bad] = why[bad] ", now calls" added
+            }
+            printf "  %-26s %7d %s%8s%s %6d %7d  %s%s%s\n", f, bytes[i], color, delta, Z,
+                   lines(bytes[i]), blocks[i], added != "" ? R : "", calls[i], Z
+        }
+        for (f in old_bytes)
+            if (!(f in seen))
+                printf "  %-26s %7s %8s\n", f, "-", "gone"
+        if (nold) {
+            printf "  %-26s %7d %s%+8d%s\n", "total", total,
+                   grew(total, old_total) ? R : total < old_total ? G : "", total - old_total, Z
+            if (grew(total, old_total))
+                why[++bad] = sprintf("total text: %d → %d bytes", old_total, total)
+        } else
+            printf "  %-26s %7d\n\n  no baseline yet (make size_baseline)\n", "total", total
+        if (bad) {
+            printf "\n%s❌ %d size regression%s (over %s%% or new callees):%s\n", R, bad,
+                   bad == 1 ? "" : "s", tol, Z
+            for (i = 1; i <= bad; i++)
+                printf "%s   %s%s\n", R, why[i], Z
+            exit 1
+        }
+        if (nold)
+            printf "\n%s✅ no size regression against %s (tolerance %s%%)%s\n", G, base, tol, Z
+    }' "$BASELINE" "$TMP/size.tsv"